@@ -0,0 +1,174 @@
+//Automatically generated header file. Do not edit!
+
+#pragma once
+
+#include <stddef.h>
+
+uint8_t birthday_text_font[] = {
+  0x30, 0x0a, 0x43, 0x12, 0x14, 0x55, 0x0d, 0x10, 0x4d, 0x14, 0x17, 0x50, 0x0c, 0x0e, 0x4c, 0x09, 0x0b, 0x45, 0x0a, 0x0c, 0x41, 0x11, 0x13, 0xd1, 0x0f, 0x12, 0x4f, 0x13, 0x15, 0x53, 0x0c, 0x0e,
+  0x7f, 0x82, 0x01, 0xed, 0xe0, 0x10, 0x00, 0x00, 0x00, 0x7c, 0x00, 0x3f, 0x80, 0x1f, 0xf0, 0x0f, 0xfe, 0x07, 0xff, 0xc3, 0xff, 0xf8, 0xf8, 0x3e, 0x3c, 0x07, 0xdf, 0x00, 0xf7, 0x80, 0x3d, 0xe0,
+  0x00, 0x70, 0x00, 0x3c, 0x00, 0x0e, 0x00, 0x03, 0xc0, 0x00, 0x70, 0x00, 0x1e, 0x00, 0x07, 0x80, 0x3d, 0xf0, 0x1f, 0x3c, 0x07, 0xcf, 0x83, 0xe3, 0xff, 0xf8, 0x7f, 0xfc, 0x0f, 0xfe, 0x01, 0xff,
+  0x00, 0x3f, 0xc0, 0x03, 0xc0, 0x7f, 0xdf, 0xff, 0xff, 0xfa, 0x20, 0x00, 0x07, 0x83, 0xdc, 0x1e, 0xf0, 0xf7, 0x8f, 0x3f, 0xf8, 0xff, 0xc7, 0xfc, 0x1f, 0xe0, 0x7e, 0x01, 0xc0, 0x7f, 0xd3, 0xce,
+  0x39, 0xc7, 0x3c, 0x00, 0x00, 0x0f, 0x80, 0x1f, 0xfc, 0x01, 0xff, 0xc0, 0x3f, 0xfe, 0x03, 0xff, 0xe0, 0x7f, 0xf7, 0x07, 0xff, 0x70, 0x6f, 0xf7, 0x0e, 0xff, 0x38, 0xef, 0xf3, 0x9c, 0xff, 0x1d,
+  0xcf, 0xf1, 0xd8, 0xff, 0x1f, 0x8f, 0xf0, 0xf8, 0xff, 0x0f, 0x0f, 0xf0, 0x70, 0xf0, 0x00, 0x00, 0x7f, 0xc5, 0x9f, 0x9a, 0x3f, 0xfe, 0x00, 0x0f, 0xf0, 0xff, 0x8f, 0xfc, 0xff, 0xee, 0x1e, 0xe0,
+  0xfe, 0x1e, 0xff, 0xef, 0xfc, 0xff, 0x8f, 0xf0, 0xe0, 0x00, 0x00, 0x7f, 0xdf, 0xff, 0xff, 0xff, 0x7e, 0x00, 0x70, 0x3f, 0xe0, 0x00, 0x7f, 0xdf, 0xbf, 0xbf, 0x7f, 0x7e, 0x00, 0x3f, 0xfe, 0x03,
+  0xff, 0xe0, 0x3f, 0xf0, 0x00, 0x7f, 0xdb, 0xd6, 0x86, 0x79, 0x9c, 0x00, 0x00, 0x00, 0xe0, 0x00, 0xf8, 0x00, 0xfe, 0x00, 0x77, 0x00, 0x7b, 0xc0, 0x39, 0xe0, 0x1c, 0x70, 0x1e, 0x38, 0x0f, 0x1e,
+  0x07, 0xff, 0x07, 0xff, 0xc7, 0xff, 0xf3, 0xc0, 0x79, 0xc0, 0x1d, 0xe0, 0x0f, 0xe0, 0x03, 0x80, 0x00, 0x00, 0x31, 0xcd, 0xd9, 0x93, 0x27, 0x6e, 0x07, 0x20, 0x1f, 0xe0, 0x1f, 0xc0, 0x27, 0x00,
+  0x00, 0x1e, 0x01, 0xfe, 0x03, 0xfe, 0x07, 0xfe, 0x0f, 0xfe, 0x1f, 0xdc, 0x3f, 0xbc, 0x7f, 0x38, 0xfe, 0x79, 0xfc, 0x73, 0xf8, 0xf7, 0xf0, 0xef, 0xe1, 0xff, 0xc1, 0xff, 0x81, 0xff, 0x01, 0xe0,
+  0x00, 0x00, 0x7f, 0x82, 0x01, 0xad, 0xa0, 0x10, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x0f, 0xe0, 0x03, 0xfe, 0x00, 0xff, 0xe0, 0x3f, 0xfe, 0x0f, 0xff, 0xe1, 0xf0, 0x7c, 0x3c, 0x07, 0xcf, 0x80, 0x79,
+  0xe0, 0x0f, 0x3c, 0x00, 0xe7, 0x00, 0x1f, 0xe0, 0x03, 0xfc, 0x00, 0x3f, 0x00, 0x07, 0xf0, 0x00, 0xfe, 0x00, 0x3d, 0xc0, 0x07, 0xbc, 0x00, 0xe7, 0x80, 0x3c, 0xf8, 0x07, 0x8f, 0x01, 0xf1, 0xf0,
+  0x7c, 0x3f, 0xff, 0x83, 0xff, 0xe0, 0x3f, 0xf8, 0x03, 0xff, 0x00, 0x3f, 0xc0, 0x01, 0xe0, 0x00, 0x7f, 0x82, 0x66, 0x00, 0x18, 0x28, 0x00, 0x00, 0xe0, 0x1f, 0x83, 0xf8, 0x3f, 0xc7, 0xfc, 0x7f,
+  0xef, 0x1e, 0xf0, 0xef, 0x00, 0x78, 0x07, 0xe0, 0x7f, 0x03, 0xf8, 0x3f, 0xc1, 0xfc, 0x0f, 0xe0, 0x7e, 0x03, 0xe0, 0x1e, 0x00, 0xe0, 0x0f, 0xe0, 0xfe, 0x0e, 0xf0, 0xef, 0x1e, 0xff, 0xe7, 0xfc,
+  0x3f, 0x81, 0xf8, 0x0e, 0x00
+};
+size_t birthday_text_font_len = 453;
+
+uint8_t happy_text_font[] = {
+  0x34, 0x05, 0x46, 0x0d, 0x11, 0x45, 0x0e, 0x12, 0x4c, 0x0c, 0x0f, 0x49, 0x05, 0x08, 0x5a, 0x11, 0x14, 0x7f, 0xbf, 0xfd, 0xfe, 0xff, 0xff, 0xf0, 0xff, 0xff, 0x80, 0x3f, 0xfd, 0xe0, 0x00, 0x7f,
+  0xbf, 0xfd, 0xfe, 0xff, 0xef, 0xf0, 0xff, 0xff, 0xc0, 0x0f, 0xff, 0xbc, 0x00, 0xff, 0xfc, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xef, 0xf0, 0xf0, 0x0f, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
+  0xf8, 0x7f, 0x92, 0xa9, 0x52, 0xa5, 0x4f, 0xf0, 0x7f, 0xff, 0x00, 0x1f, 0x80, 0x0f, 0x80, 0x0f, 0xc0, 0x07, 0xc0, 0x07, 0xe0, 0x03, 0xe0, 0x03, 0xf0, 0x01, 0xf0, 0x01, 0xf8, 0x00, 0xf8, 0x00,
+  0xfc, 0x00, 0x7c, 0x00, 0x7e, 0x00, 0x3e, 0x00, 0x3f, 0x00, 0x1f, 0x00, 0x1f, 0x80, 0x0f, 0x80, 0x0f, 0xc0, 0x07, 0xc0, 0x07, 0xff, 0xfc
+};
+size_t happy_text_font_len = 119;
+
+uint8_t images_atlas[] = {
+  0x02, 0x00, 0x00, 0x00, 0x00, 0xb0, 0x00, 0xe0, 0x01, 0x00, 0x00, 0xe0, 0x01, 0x10, 0x00, 0x20, 0x00, 0x50, 0x34, 0x0a, 0x31, 0x37, 0x36, 0x20, 0x35, 0x31, 0x32, 0x0a, 0xff, 0xff, 0x09, 0x80,
+  0x3f, 0xff, 0xff, 0x07, 0x00, 0x00, 0x08, 0x03, 0x80, 0x38, 0x00, 0x00, 0x11, 0x04, 0x06, 0x06, 0x00, 0x00, 0x00, 0x11, 0x19, 0xf9, 0xf1, 0x80, 0x00, 0x00, 0x10, 0x62, 0x00, 0x0c, 0x40, 0x00,
+  0x00, 0x10, 0x8c, 0x00, 0x03, 0x20, 0x00, 0x00, 0x0f, 0x01, 0x30, 0x00, 0x00, 0x00, 0x90, 0x00, 0x00, 0x0f, 0x02, 0x40, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x0f, 0x04, 0x80, 0x00, 0x00, 0x00,
+  0x34, 0x00, 0x00, 0x0f, 0x01, 0x00, 0x00, 0x01, 0x0a, 0x00, 0x00, 0x0f, 0x0a, 0x00, 0x00, 0x01, 0x05, 0x00, 0x00, 0x0f, 0x14, 0x00, 0x00, 0x13, 0x28, 0x00, 0x00, 0x01, 0x02, 0x80, 0x00, 0x00,
+  0x12, 0x01, 0x40, 0x00, 0x00, 0x0e, 0x50, 0x00, 0x00, 0x02, 0x80, 0x00, 0x00, 0x0e, 0xa0, 0x00, 0x00, 0x02, 0x20, 0x00, 0x00, 0x13, 0x50, 0x00, 0x00, 0x0d, 0x01, 0x40, 0x00, 0x00, 0x02, 0x20,
+  0x00, 0x00, 0x13, 0x08, 0x00, 0x00, 0x0d, 0x02, 0x80, 0x00, 0x00, 0x02, 0x10, 0x00, 0x00, 0x0d, 0x01, 0x00, 0x00, 0x03, 0x04, 0x00, 0x00, 0x0d, 0x04, 0x20, 0x00, 0x00, 0x02, 0x08, 0x00, 0x00,
+  0x0d, 0x02, 0x40, 0x00, 0x00, 0x12, 0x08, 0x80, 0x00, 0x00, 0x02, 0x06, 0x00, 0x00, 0x0d, 0x04, 0x40, 0x00, 0x00, 0x12, 0x01, 0x80, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x0d, 0x10, 0x20, 0x00,
+  0x00, 0x12, 0x0b, 0x40, 0x00, 0x00, 0x02, 0x01, 0x80, 0x00, 0x00, 0x0c, 0x20, 0x00, 0x00, 0x13, 0x16, 0x40, 0x00, 0x00, 0x13, 0x80, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x0c, 0x48, 0x00, 0x00,
+  0x04, 0x40, 0x00, 0x00, 0x0c, 0x24, 0x80, 0x00, 0x00, 0x0e, 0x03, 0xff, 0xc0, 0x00, 0x11, 0x00, 0x00, 0x04, 0x40, 0x00, 0x00, 0x08, 0x0c, 0x00, 0x30, 0x00, 0x88, 0x00, 0x00, 0x04, 0x20, 0x00,
+  0x00, 0x08, 0x31, 0xff, 0x8c, 0x00, 0x61, 0x00, 0x00, 0x06, 0x7f, 0xc0, 0x00, 0x00, 0x05, 0x46, 0x00, 0x62, 0x00, 0x02, 0x00, 0x00, 0x05, 0x03, 0x80, 0x38, 0x00, 0x00, 0x04, 0x01, 0x98, 0x00,
+  0x19, 0x00, 0x10, 0x00, 0x00, 0x04, 0x30, 0x04, 0x0f, 0x06, 0x00, 0x00, 0x04, 0x02, 0x20, 0x00, 0x06, 0x81, 0x42, 0x00, 0x00, 0x05, 0x18, 0xf0, 0xe1, 0x80, 0x00, 0x00, 0x03, 0x04, 0xc0, 0x00,
+  0x01, 0x60, 0xa4, 0x00, 0x00, 0x05, 0x23, 0x00, 0x1c, 0x40, 0x00, 0x00, 0x03, 0x09, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x06, 0xcc, 0x00, 0x03, 0x20, 0x00, 0x00, 0x03, 0x12, 0x00, 0x00, 0x01,
+  0x50, 0x84, 0x00, 0x00, 0x04, 0x11, 0x10, 0x00, 0x00, 0x00, 0x90, 0x00, 0x00, 0x03, 0x04, 0x00, 0x00, 0x01, 0x2a, 0x48, 0x00, 0x00, 0x04, 0x08, 0x60, 0x00, 0x00, 0x00, 0x68, 0x00, 0x00, 0x03,
+  0x28, 0x00, 0x00, 0x01, 0x15, 0x00, 0x00, 0x05, 0x02, 0x80, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x03, 0x50, 0x00, 0x00, 0x01, 0x09, 0x00, 0x00, 0x05, 0x05, 0x00, 0x00, 0x01, 0x0a, 0x00, 0x00,
+  0x03, 0x84, 0x00, 0x00, 0x01, 0x04, 0x08, 0x00, 0x00, 0x04, 0x02, 0x00, 0x00, 0x01, 0x05, 0x00, 0x00, 0x03, 0x28, 0x00, 0x00, 0x02, 0x90, 0x00, 0x00, 0x04, 0x14, 0x00, 0x00, 0x01, 0x02, 0x80,
+  0x00, 0x00, 0x01, 0x01, 0x50, 0x00, 0x00, 0x01, 0x02, 0x00, 0x00, 0x0f, 0x88, 0x00, 0x00, 0x01, 0x01, 0x80, 0x00, 0x00, 0x04, 0x28, 0x00, 0x00, 0x01, 0x01, 0x40, 0x00, 0x00, 0x01, 0x02, 0x34,
+  0x00, 0x00, 0x02, 0xf0, 0x00, 0x00, 0x04, 0x50, 0x00, 0x00, 0x02, 0xa0, 0x00, 0x00, 0x01, 0x01, 0x08, 0x00, 0x00, 0x12, 0x04, 0x60, 0x00, 0x00, 0x02, 0x40, 0x00, 0x00, 0x04, 0xa0, 0x00, 0x00,
+  0x02, 0x50, 0x00, 0x00, 0x01, 0x02, 0x80, 0x00, 0x00, 0x08, 0x01, 0x40, 0x00, 0x00, 0x02, 0x20, 0x00, 0x00, 0x01, 0x08, 0x48, 0x00, 0x00, 0x02, 0x30, 0x00, 0x00, 0x09, 0x08, 0x00, 0x00, 0x01,
+  0x04, 0x10, 0x00, 0x00, 0x04, 0x07, 0xff, 0x80, 0x00, 0x02, 0x80, 0x00, 0x00, 0x02, 0x10, 0x00, 0x00, 0x01, 0x11, 0x00, 0x00, 0x03, 0x18, 0x00, 0x18, 0x00, 0x70, 0x00, 0x00, 0x05, 0x0c, 0x00,
+  0x00, 0x01, 0x08, 0x90, 0x00, 0x00, 0x04, 0x61, 0xff, 0x08, 0x00, 0x05, 0x00, 0x00, 0x07, 0x22, 0x20, 0x00, 0x00, 0x03, 0x01, 0x8e, 0x00, 0xc6, 0x00, 0x00, 0x05, 0x02, 0x00, 0x00, 0x01, 0x11,
+  0x00, 0x00, 0x03, 0x0c, 0x02, 0x30, 0x00, 0x31, 0x00, 0x02, 0x00, 0x00, 0x03, 0x44, 0x00, 0x00, 0x01, 0x04, 0x20, 0x00, 0x00, 0x03, 0x04, 0x40, 0x00, 0x0c, 0xc0, 0x08, 0x00, 0x00, 0x03, 0x61,
+  0x00, 0x00, 0x01, 0x42, 0x40, 0x00, 0x00, 0x02, 0x06, 0x09, 0x80, 0x00, 0x03, 0x20, 0x04, 0x00, 0x00, 0x03, 0xb2, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x04, 0x12, 0x00, 0x00, 0x01, 0x90, 0x10,
+  0x00, 0x00, 0x03, 0x10, 0x00, 0x00, 0x01, 0x08, 0x40, 0x00, 0x00, 0x02, 0x02, 0x24, 0x00, 0x00, 0x01, 0x48, 0x08, 0x00, 0x00, 0x03, 0x89, 0x80, 0x00, 0x00, 0x00, 0x84, 0x80, 0x00, 0x00, 0x02,
+  0x01, 0x48, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x04, 0x08, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x04, 0x90, 0x00, 0x00, 0x01, 0x14, 0x20, 0x00, 0x00, 0x03, 0x44, 0x00, 0x00, 0x01, 0x10, 0x80,
+  0x00, 0x00, 0x03, 0x20, 0x00, 0x00, 0x01, 0x0a, 0x10, 0x00, 0x00, 0x04, 0xc0, 0x00, 0x01, 0x09, 0x00, 0x00, 0x04, 0x40, 0x00, 0x00, 0x01, 0x04, 0x40, 0x00, 0x00, 0x03, 0x44, 0x00, 0x00, 0x01,
+  0x80, 0x00, 0x00, 0x03, 0x02, 0x80, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x20, 0x00, 0x00, 0x03, 0x22, 0x00, 0x00, 0x01, 0x21, 0x00, 0x00, 0x07, 0x01, 0xc2, 0x80, 0x00, 0x00, 0x04, 0x60, 0x00,
+  0x00, 0x00, 0x02, 0x00, 0x00, 0x03, 0x05, 0x00, 0x00, 0x02, 0xe1, 0x00, 0x00, 0x04, 0x22, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x00, 0x03, 0x0a, 0x00, 0x00, 0x02, 0x30, 0x00, 0x00, 0x04, 0x11,
+  0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x0a, 0xa0, 0x00, 0x00, 0x04, 0x20, 0x00, 0x00, 0x00, 0x42, 0x00, 0x00, 0x03, 0x14, 0x00, 0x00, 0x01, 0x01, 0x18, 0x40, 0x00, 0x00, 0x03, 0x10, 0x10, 0x00,
+  0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x07, 0x01, 0x0c, 0x10, 0x00, 0x00, 0x03, 0x09, 0x80, 0x00, 0x00, 0x06, 0x28, 0x00, 0x00, 0x02, 0x82, 0x20, 0x00, 0x00, 0x06, 0x04, 0x00, 0x00, 0x04, 0x10,
+  0x00, 0x00, 0x02, 0xc4, 0x08, 0x00, 0x00, 0x04, 0x10, 0x00, 0x02, 0x84, 0x00, 0x00, 0x03, 0x40, 0x00, 0x00, 0x02, 0x01, 0x10, 0x00, 0x00, 0x03, 0x0c, 0x48, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00,
+  0x03, 0x20, 0x00, 0x00, 0x02, 0x62, 0x04, 0x00, 0x00, 0x04, 0x80, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x02, 0x31, 0x88, 0x00, 0x00, 0x1a, 0x08, 0x00, 0x08, 0x00, 0x00,
+  0x04, 0x40, 0x00, 0x00, 0x02, 0x18, 0xc6, 0x00, 0x00, 0x03, 0x06, 0x00, 0x00, 0x00, 0x05, 0x18, 0x00, 0x00, 0x02, 0x01, 0x00, 0x00, 0x0b, 0x24, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x03, 0x80,
+  0x00, 0x00, 0x02, 0x0c, 0x20, 0x00, 0x00, 0x04, 0x40, 0x00, 0x00, 0x05, 0x02, 0x00, 0x00, 0x04, 0x43, 0x00, 0x00, 0x0c, 0x01, 0x00, 0x00, 0x03, 0x06, 0x10, 0x00, 0x00, 0x12, 0x01, 0x21, 0x80,
+  0x00, 0x00, 0x02, 0x01, 0x04, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x03, 0x02, 0x08, 0x00, 0x00, 0x03, 0x02, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x02, 0x02, 0x00,
+  0x00, 0x04, 0x10, 0x00, 0x00, 0x04, 0x02, 0x00, 0x12, 0x00, 0x00, 0x0a, 0x80, 0x80, 0x00, 0x00, 0x00, 0x03, 0x20, 0x00, 0x01, 0x00, 0x00, 0x03, 0x08, 0x00, 0x00, 0x03, 0x01, 0x04, 0x40, 0x00,
+  0x00, 0x05, 0x08, 0x00, 0x00, 0x03, 0x04, 0x00, 0x00, 0x04, 0x48, 0x00, 0x00, 0x13, 0x80, 0x40, 0x00, 0x00, 0x02, 0x01, 0x80, 0x00, 0x00, 0x0c, 0x02, 0x20, 0x00, 0x00, 0x03, 0x02, 0x00, 0x00,
+  0x05, 0x10, 0x00, 0x00, 0x04, 0x64, 0x00, 0x00, 0x04, 0x08, 0x00, 0x00, 0x05, 0x08, 0x00, 0x00, 0x1a, 0x01, 0x20, 0x00, 0x00, 0x06, 0x20, 0x00, 0x00, 0x09, 0x32, 0x10, 0x00, 0x00, 0x0b, 0x20,
+  0x00, 0x00, 0x0b, 0x10, 0x00, 0x00, 0x05, 0x10, 0x00, 0x00, 0x1a, 0x18, 0x90, 0x00, 0x00, 0x03, 0x81, 0x00, 0x00, 0x0c, 0x01, 0x00, 0x00, 0x0c, 0x40, 0x00, 0x00, 0x05, 0x08, 0x00, 0x00, 0x0b,
+  0x20, 0x00, 0x00, 0x0b, 0x01, 0x00, 0x00, 0x0c, 0x0c, 0x40, 0x00, 0x00, 0x03, 0x41, 0x00, 0x00, 0x0d, 0x88, 0x00, 0x00, 0x1b, 0x02, 0x00, 0x00, 0x0a, 0x04, 0x00, 0x00, 0x0c, 0x80, 0x00, 0x00,
+  0x05, 0x04, 0x00, 0x00, 0x0b, 0x40, 0x00, 0x00, 0x04, 0x02, 0x20, 0x00, 0x00, 0x13, 0x40, 0x00, 0x00, 0x03, 0x01, 0x00, 0x01, 0x00, 0x00, 0x0a, 0x02, 0x00, 0x00, 0x14, 0x04, 0x00, 0x00, 0x05,
+  0x01, 0x00, 0x00, 0x0a, 0x01, 0x00, 0x00, 0x1a, 0x01, 0x00, 0x00, 0x04, 0x01, 0x00, 0x00, 0x14, 0x80, 0x00, 0x00, 0x04, 0x01, 0x12, 0x00, 0x00, 0x03, 0x40, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00,
+  0x0a, 0x20, 0x00, 0x00, 0x06, 0xe0, 0x00, 0x00, 0x0a, 0x80, 0x00, 0x00, 0x06, 0x10, 0x00, 0x00, 0x10, 0x01, 0x00, 0x01, 0x00, 0x00, 0x13, 0x10, 0x00, 0x00, 0x0b, 0x82, 0x00, 0x00, 0x05, 0x09,
+  0x00, 0x00, 0x11, 0x01, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x0a, 0x40, 0x00, 0x00, 0x03, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x13, 0xe0, 0x00, 0x00, 0x10, 0x18, 0x00, 0x00, 0x04, 0x01,
+  0x00, 0x00, 0x06, 0x40, 0x00, 0x00, 0x0a, 0x02, 0x00, 0x00, 0x06, 0x20, 0x00, 0x00, 0x19, 0x20, 0x00, 0x00, 0x0d, 0x30, 0x00, 0x00, 0x03, 0x10, 0x00, 0x08, 0x00, 0x00, 0x11, 0x20, 0x00, 0x04,
+  0x00, 0x00, 0x0b, 0x30, 0x00, 0x00, 0x03, 0x62, 0x00, 0x00, 0x0d, 0x08, 0x00, 0x00, 0x07, 0x0f, 0xf0, 0x00, 0x00, 0x08, 0x30, 0x00, 0x00, 0x03, 0xd0, 0x00, 0x00, 0x01, 0x70, 0x0e, 0x00, 0x00,
+  0x08, 0x44, 0x00, 0x00, 0x03, 0x22, 0x00, 0x00, 0x00, 0x01, 0x87, 0xe1, 0x80, 0x00, 0x00, 0x07, 0x08, 0x00, 0x00, 0x05, 0x04, 0x06, 0x38, 0x1e, 0x40, 0x00, 0x00, 0x07, 0x04, 0x00, 0x00, 0x05,
+  0x02, 0x08, 0xc0, 0x01, 0xb0, 0x00, 0x00, 0x07, 0x20, 0x00, 0x00, 0x06, 0x13, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x07, 0x50, 0x00, 0x00, 0x03, 0x50, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00,
+  0x34, 0x00, 0x00, 0x0d, 0xa4, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x07, 0x30, 0x00, 0x00, 0x03, 0x60, 0x00, 0x02, 0x90, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x0f, 0x01,
+  0x20, 0x00, 0x00, 0x00, 0x02, 0x80, 0x00, 0x00, 0x0c, 0x04, 0x00, 0x02, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x06, 0x03, 0xff, 0x00, 0x00, 0x05, 0x04, 0x80, 0x00, 0x00, 0x01, 0x40, 0x00,
+  0x00, 0x05, 0x0c, 0x00, 0xe0, 0x00, 0x00, 0x04, 0x01, 0x00, 0x00, 0x02, 0xa0, 0x00, 0x00, 0x05, 0x70, 0x30, 0x18, 0x00, 0x00, 0x02, 0x08, 0x00, 0x0a, 0x00, 0x00, 0x02, 0x40, 0x00, 0x00, 0x05,
+  0x87, 0xcf, 0x84, 0x00, 0x00, 0x09, 0x30, 0x00, 0x00, 0x04, 0x01, 0x18, 0x00, 0x63, 0x00, 0x00, 0x02, 0x08, 0x00, 0x14, 0x00, 0x00, 0x02, 0x0a, 0x00, 0x00, 0x04, 0x02, 0x60, 0x00, 0x18, 0x80,
+  0x00, 0x00, 0x03, 0x28, 0x00, 0x00, 0x02, 0x10, 0x00, 0x00, 0x04, 0x04, 0x80, 0x00, 0x06, 0x40, 0x00, 0x00, 0x08, 0x0c, 0x00, 0x00, 0x04, 0x0b, 0x00, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x01,
+  0x10, 0x00, 0x50, 0x00, 0x00, 0x09, 0x14, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x08, 0x06, 0x00, 0x00, 0x04, 0x28, 0x00, 0x00, 0x01, 0x48, 0x00, 0x00, 0x01, 0x10, 0x00, 0xa0, 0x00, 0x00, 0x09,
+  0x50, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x08, 0x03, 0x00, 0x00, 0x04, 0xa0, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x01, 0x20, 0x00, 0x40, 0x00, 0x00, 0x08, 0x01, 0x00, 0x00, 0x02, 0x0a, 0x00,
+  0x00, 0x02, 0x01, 0x00, 0x00, 0x03, 0x01, 0x80, 0x00, 0x00, 0x03, 0x40, 0x00, 0x00, 0x01, 0x05, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x08, 0x02, 0x80, 0x00, 0x00, 0x05, 0x20, 0x02, 0x00, 0x00,
+  0x04, 0x80, 0x00, 0x00, 0x02, 0x05, 0x00, 0x00, 0x02, 0x02, 0x80, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x07, 0x01, 0x00, 0x00, 0x02, 0x01, 0x00, 0x00, 0x09, 0x0a, 0x00,
+  0x00, 0x03, 0x40, 0x00, 0x00, 0x01, 0x04, 0x00, 0x00, 0x04, 0x60, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x03, 0xa0, 0x00, 0x00, 0x00, 0x40, 0x02, 0x00, 0x00, 0x09, 0x10, 0x00, 0x00, 0x03, 0x40,
+  0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x05, 0x20, 0x00, 0x00, 0x02, 0x08, 0x00, 0x00, 0x03, 0x10, 0x00, 0x00, 0x01, 0x08, 0x00, 0x00, 0x04, 0x10, 0x00, 0x00, 0x02, 0x20, 0x00, 0x00, 0x03, 0x20,
+  0x00, 0x00, 0x00, 0x80, 0x04, 0x00, 0x00, 0x09, 0x10, 0x00, 0x00, 0x05, 0x01, 0x00, 0x00, 0x06, 0x10, 0x00, 0x00, 0x02, 0x40, 0x00, 0x00, 0x03, 0x18, 0x00, 0x00, 0x08, 0x08, 0x00, 0x00, 0x02,
+  0x20, 0x00, 0x00, 0x07, 0x10, 0x00, 0x00, 0x09, 0x80, 0x00, 0x00, 0x03, 0x04, 0x00, 0x01, 0x00, 0x08, 0x00, 0x00, 0x04, 0x08, 0x00, 0x00, 0x02, 0x40, 0x00, 0x00, 0x03, 0x08, 0x00, 0x02, 0x00,
+  0x00, 0x11, 0x02, 0x00, 0x00, 0x08, 0x04, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x04, 0x04, 0x00, 0x06, 0x00, 0x20, 0x00, 0x00, 0x09, 0x80, 0x00, 0x00, 0x07, 0x10, 0x00, 0x00, 0x04, 0x04, 0x00,
+  0x00, 0x08, 0x02, 0x00, 0x00, 0x0c, 0x02, 0x00, 0x00, 0x04, 0x01, 0x00, 0x0c, 0x00, 0x00, 0x06, 0x02, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x13, 0x04, 0x00, 0x00, 0x05, 0x80, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x04, 0x02, 0x00, 0x00, 0x08, 0x01, 0x00, 0x18, 0x00, 0x20, 0x00, 0x00, 0x08, 0x02, 0x00, 0x00, 0x0f, 0x01, 0x00, 0x07, 0xc0, 0x00, 0x00, 0x07, 0x20, 0x00, 0x00, 0x08, 0x38,
+  0x3c, 0x08, 0x00, 0x00, 0x05, 0xc0, 0x10, 0x00, 0x00, 0x06, 0x01, 0x01, 0x00, 0xc0, 0x03, 0x04, 0x00, 0x00, 0x10, 0x02, 0x0f, 0xf0, 0xc0, 0x00, 0x00, 0x06, 0x60, 0x00, 0x00, 0x07, 0x0c, 0x70,
+  0x0e, 0x30, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x05, 0x11, 0x80, 0x01, 0x80, 0x00, 0x00, 0x05, 0x20, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x05, 0xa6, 0x00, 0x00, 0x00,
+  0x64, 0x00, 0x00, 0x06, 0xc0, 0x00, 0x00, 0x07, 0x48, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x10, 0x10, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x05, 0x01, 0x80, 0x00, 0x00, 0x06, 0x01, 0x20, 0x00,
+  0x00, 0x00, 0x04, 0x80, 0x00, 0x00, 0x04, 0x20, 0x00, 0x00, 0x07, 0x02, 0x40, 0x00, 0x00, 0x00, 0x02, 0x40, 0x00, 0x00, 0x04, 0x12, 0x00, 0x00, 0x07, 0x04, 0x80, 0x00, 0x00, 0x00, 0x01, 0x00,
+  0x00, 0x05, 0x01, 0x00, 0x00, 0x07, 0x01, 0x00, 0x00, 0x02, 0xa0, 0x00, 0x00, 0x04, 0x04, 0x00, 0x00, 0x07, 0x0a, 0x00, 0x00, 0x02, 0x50, 0x00, 0x00, 0x04, 0x02, 0x00, 0x00, 0x07, 0x14, 0x00,
+  0x00, 0x09, 0x18, 0x00, 0x00, 0x0c, 0x28, 0x00, 0x00, 0x04, 0x04, 0x00, 0x00, 0x07, 0x28, 0x00, 0x00, 0x02, 0x14, 0x00, 0x00, 0x0e, 0x50, 0x00, 0x00, 0x02, 0x08, 0x00, 0x00, 0x13, 0x02, 0x00,
+  0x00, 0x07, 0x08, 0x00, 0x00, 0x04, 0xa0, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x07, 0x10, 0x00, 0x00, 0x09, 0x01, 0x00, 0x00, 0x07, 0x08, 0x00, 0x00, 0x03, 0x01, 0x40, 0x00, 0x00, 0x02, 0x02,
+  0x00, 0x00, 0x04, 0x08, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x0a, 0x80, 0x00, 0x00, 0x0d, 0x80, 0x00, 0x00, 0x02, 0x01, 0x00, 0x00, 0x0d, 0x02, 0x00, 0x00, 0x0d, 0x04, 0x00, 0x00, 0x03, 0x01,
+  0x00, 0x00, 0x04, 0xc0, 0x00, 0x00, 0x0c, 0x04, 0x00, 0x00, 0x0a, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x03, 0x02, 0x00, 0x00, 0x04, 0x60, 0x00, 0x00, 0x19, 0x80, 0x00, 0x00, 0x06, 0x08,
+  0x00, 0x00, 0x0a, 0x80, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x03, 0x04, 0x00, 0x00, 0x04, 0x30, 0x00, 0x00, 0x06, 0x08, 0x00, 0x00, 0x03, 0x10, 0x00, 0x00, 0x09, 0x01, 0x20, 0x00, 0x00, 0x00,
+  0x11, 0x00, 0x00, 0x19, 0x08, 0x00, 0x00, 0x04, 0x18, 0x00, 0x00, 0x0c, 0x03, 0x00, 0x00, 0x13, 0x24, 0x00, 0x00, 0x0d, 0x01, 0x00, 0x00, 0x03, 0x12, 0x00, 0x00, 0x04, 0x0c, 0x00, 0x00, 0x02,
+  0x01, 0x00, 0x00, 0x02, 0x80, 0x00, 0x00, 0x12, 0x04, 0x00, 0x00, 0x03, 0x40, 0x00, 0x00, 0x0d, 0x08, 0x00, 0x00, 0x03, 0x2c, 0x00, 0x00, 0x04, 0x04, 0x00, 0x00, 0x13, 0x02, 0x00, 0x00, 0x06,
+  0xc0, 0x80, 0x00, 0x00, 0x02, 0x01, 0x00, 0x00, 0x0e, 0x40, 0x00, 0x00, 0x02, 0x80, 0x00, 0x00, 0x0d, 0x02, 0x00, 0x00, 0x03, 0x50, 0x00, 0x00, 0x04, 0x02, 0x00, 0x00, 0x02, 0x02, 0x00, 0x00,
+  0x07, 0x08, 0x00, 0x00, 0x0d, 0x04, 0x00, 0x00, 0x0a, 0x01, 0x00, 0x00, 0x07, 0x40, 0x00, 0x00, 0x02, 0x02, 0x00, 0x00, 0x0e, 0x20, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x0b, 0x04, 0x00, 0x00,
+  0x00, 0x40, 0x00, 0x00, 0x0a, 0x01, 0x00, 0x00, 0x06, 0x21, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x0a, 0x64, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x03, 0x20, 0x00, 0x00, 0x05, 0x80, 0x00, 0x00,
+  0x06, 0x30, 0x00, 0x00, 0x02, 0x12, 0x00, 0x00, 0x20, 0x04, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x01, 0x02, 0x00, 0x00, 0x06, 0x80, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00,
+  0x10, 0x04, 0x00, 0x00, 0x00, 0x01, 0x08, 0x00, 0x00, 0x01, 0x01, 0x04, 0x00, 0x00, 0x09, 0x04, 0x00, 0x00, 0x02, 0x10, 0x00, 0x00, 0x0e, 0x02, 0x00, 0x00, 0x0f, 0x40, 0x00, 0x00, 0x06, 0x40,
+  0x00, 0x00, 0x02, 0x40, 0x00, 0x00, 0x0a, 0x80, 0x00, 0x00, 0x00, 0x18, 0x84, 0x00, 0x00, 0x13, 0x08, 0x00, 0x00, 0x02, 0x20, 0x00, 0x00, 0x0a, 0x40, 0x00, 0x00, 0x0e, 0x40, 0x00, 0x00, 0x06,
+  0x20, 0x00, 0x00, 0x01, 0x04, 0x04, 0x00, 0x00, 0x00, 0x0a, 0x08, 0x00, 0x00, 0x00, 0x08, 0x42, 0x00, 0x00, 0x01, 0x02, 0x00, 0x00, 0x0b, 0x08, 0x00, 0x00, 0x00, 0x04, 0x04, 0x00, 0x00, 0x00,
+  0x02, 0x08, 0x00, 0x00, 0x09, 0x0c, 0x00, 0x00, 0x18, 0x11, 0x00, 0x00, 0x0e, 0x01, 0x00, 0x00, 0x01, 0x06, 0x22, 0x00, 0x00, 0x25, 0x80, 0x00, 0x00, 0x01, 0x08, 0x00, 0x00, 0x02, 0x80, 0x00,
+  0x00, 0x05, 0x20, 0x00, 0x00, 0x02, 0x10, 0x00, 0x00, 0x00, 0x02, 0x11, 0x80, 0x00, 0x00, 0x0d, 0x08, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x0b, 0x20, 0x00, 0x00, 0x01, 0x10, 0x10, 0x00, 0x00,
+  0x00, 0x16, 0x01, 0x0c, 0xc0, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x05, 0x20, 0x00, 0x00, 0x01, 0x02, 0x00, 0x00, 0x02, 0x80, 0x00, 0x00, 0x14, 0x40, 0x00, 0x00, 0x0d, 0x01, 0x20, 0x00, 0x00,
+  0x01, 0x86, 0x20, 0x00, 0x00, 0x01, 0x10, 0x00, 0x00, 0x09, 0x10, 0x00, 0x00, 0x02, 0x40, 0x00, 0x00, 0x0f, 0x20, 0x00, 0x00, 0x02, 0x20, 0x00, 0x00, 0x01, 0x08, 0x00, 0x00, 0x05, 0x20, 0x00,
+  0x00, 0x01, 0x20, 0x00, 0x00, 0x02, 0x43, 0x00, 0x00, 0x0e, 0x04, 0x40, 0x00, 0x00, 0x01, 0x20, 0x10, 0x00, 0x00, 0x12, 0x21, 0x00, 0x00, 0x0e, 0x02, 0x00, 0x00, 0x02, 0x10, 0x90, 0x00, 0x00,
+  0x0d, 0x20, 0x40, 0x00, 0x00, 0x02, 0x80, 0x00, 0x00, 0x09, 0x20, 0x00, 0x00, 0x02, 0x80, 0x00, 0x00, 0x01, 0x18, 0x40, 0x00, 0x00, 0x0d, 0x48, 0x00, 0x00, 0x03, 0x77, 0x00, 0x00, 0x0d, 0x04,
+  0x00, 0x00, 0x02, 0x08, 0x3c, 0x00, 0x00, 0x0e, 0x80, 0x00, 0x00, 0x01, 0x04, 0x02, 0x00, 0x00, 0x09, 0x20, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x0f, 0x20, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00,
+  0x02, 0x06, 0x00, 0x00, 0x0e, 0x10, 0x00, 0x00, 0x0f, 0x20, 0x00, 0x00, 0x01, 0x89, 0x00, 0x00, 0x02, 0x03, 0x06, 0x00, 0x00, 0x0d, 0x02, 0x00, 0x00, 0x03, 0x09, 0x00, 0x00, 0x12, 0x01, 0x86,
+  0x00, 0x00, 0x0d, 0x32, 0x00, 0x00, 0x07, 0x10, 0x00, 0x00, 0x09, 0x04, 0x00, 0x00, 0x03, 0xc0, 0x00, 0x00, 0x0d, 0x80, 0x00, 0x00, 0x06, 0x04, 0x00, 0x00, 0x0a, 0x60, 0x00, 0x00, 0x03, 0x60,
+  0x00, 0x00, 0x0d, 0x0c, 0x00, 0x00, 0x06, 0x02, 0x00, 0x00, 0x06, 0x40, 0x00, 0x00, 0x01, 0xc0, 0x00, 0x00, 0x03, 0x30, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x08, 0x06, 0x80, 0x00, 0x00, 0x03,
+  0x10, 0x00, 0x00, 0x0c, 0x05, 0x18, 0x00, 0x00, 0x03, 0x08, 0x00, 0x00, 0x0c, 0x0a, 0x00, 0x00, 0x04, 0x0c, 0x00, 0x00, 0x09, 0x40, 0x00, 0x00, 0x07, 0x04, 0x00, 0x00, 0x01, 0x10, 0x00, 0x00,
+  0x09, 0x30, 0x00, 0x00, 0x03, 0x02, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x0f, 0x03, 0x00, 0x00, 0x00, 0x02, 0x70, 0x00, 0x00, 0x13, 0x20, 0x00, 0x00, 0x05, 0x80, 0x00, 0x00, 0x00, 0x0f, 0x60,
+  0x00, 0x00, 0x03, 0x01, 0x80, 0x00, 0x01, 0x00, 0x00, 0x09, 0x06, 0x00, 0x00, 0x05, 0xc0, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x09, 0x80, 0x00, 0x00, 0x04, 0x40, 0x00, 0x00, 0x00, 0x1c, 0x00,
+  0x00, 0x09, 0x40, 0x00, 0x00, 0x04, 0x20, 0x00, 0x00, 0x08, 0x80, 0x00, 0x00, 0x08, 0x30, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x08, 0x01, 0x80, 0x00, 0x00, 0x04, 0x18, 0x00, 0x01, 0x00, 0x00,
+  0x11, 0x0c, 0x00, 0x00, 0x00, 0xc0, 0x00, 0x00, 0x04, 0x01, 0x00, 0x00, 0x01, 0x03, 0x00, 0x00, 0x05, 0x02, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x10, 0x05, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00,
+  0x08, 0x04, 0x00, 0x00, 0x05, 0x02, 0x80, 0x00, 0x10, 0x00, 0x00, 0x04, 0x01, 0x00, 0x00, 0x01, 0x02, 0x00, 0x00, 0x05, 0x01, 0x40, 0x00, 0x80, 0x00, 0x00, 0x11, 0xf0, 0x00, 0x00, 0x06, 0x02,
+  0x00, 0x00, 0x01, 0x0c, 0x00, 0x00, 0x06, 0x28, 0x00, 0xc0, 0x00, 0x00, 0x11, 0x16, 0x03, 0x00, 0x00, 0x09, 0x18, 0x00, 0x00, 0x06, 0x09, 0xfc, 0x00, 0x00, 0x05, 0x02, 0x00, 0x00, 0x0a, 0x07,
+  0x03, 0x00, 0x00, 0x09, 0x30, 0x00, 0x00, 0x07, 0xf3, 0x40, 0x00, 0x00, 0x04, 0x04, 0x00, 0x00, 0x0c, 0x20, 0x00, 0x00, 0x08, 0x60, 0x00, 0x00, 0x08, 0x80, 0x00, 0x00, 0x08, 0x80, 0x00, 0x00,
+  0x07, 0x07, 0x20, 0x00, 0x00, 0x04, 0x04, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x0f, 0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x09, 0x10, 0x00, 0x00, 0x08, 0x80, 0x00, 0x00, 0x12, 0x02, 0x00,
+  0x00, 0x10, 0x08, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x09, 0x20, 0x00, 0x00, 0x04, 0x10, 0x00, 0x00, 0x0b, 0x03, 0x08, 0x00, 0x00, 0x07, 0x0a, 0x00, 0x00, 0x08, 0x05, 0xf0, 0x00, 0x00, 0x07,
+  0x14, 0x00, 0x00, 0x08, 0x01, 0xd0, 0x00, 0x00, 0x04, 0x30, 0x00, 0x00, 0x0b, 0x03, 0x08, 0x00, 0x00, 0x07, 0x28, 0x00, 0x00, 0x09, 0x14, 0x00, 0x00, 0x07, 0x50, 0x00, 0x00, 0x08, 0x04, 0x08,
+  0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x08, 0x08, 0x0c, 0x00, 0x00, 0x04, 0x40, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x09, 0x02, 0x00, 0x00, 0x06, 0x01, 0x40, 0x00, 0x00, 0x09, 0x04, 0x00, 0x00,
+  0x04, 0x30, 0x00, 0x02, 0x80, 0x00, 0x00, 0x09, 0x06, 0x00, 0x00, 0x04, 0xa8, 0x00, 0x05, 0x00, 0x00, 0x11, 0x14, 0x00, 0x1a, 0x00, 0x00, 0x0a, 0x03, 0x00, 0x00, 0x04, 0x0a, 0x00, 0x24, 0x00,
+  0x00, 0x0a, 0x03, 0x00, 0x00, 0x03, 0x01, 0x85, 0x00, 0xc8, 0x00, 0x00, 0x0a, 0x01, 0x80, 0x00, 0x00, 0x03, 0x42, 0xc1, 0x10, 0x00, 0x00, 0x11, 0x21, 0x3e, 0x60, 0x00, 0x00, 0x0a, 0x01, 0x80,
+  0x00, 0x00, 0x02, 0x02, 0xc1, 0xc0, 0x80, 0x00, 0x00, 0x0b, 0xc0, 0x00, 0x00, 0x02, 0x01, 0x00, 0x3d, 0x00, 0x00, 0x13, 0x84, 0x00, 0x00, 0x0c, 0xc0, 0x00, 0x00, 0x02, 0x06, 0x00, 0x48, 0x00,
+  0x00, 0x0c, 0x60, 0x00, 0x00, 0x03, 0x03, 0x32, 0x00, 0x00, 0x12, 0xc0, 0x80, 0x00, 0x00, 0x0c, 0x70, 0x00, 0x00, 0x02, 0x0c, 0x80, 0x02, 0x00, 0x00, 0x11, 0x01, 0x04, 0x7c, 0x00, 0x00, 0x0c,
+  0x20, 0x00, 0x00, 0x02, 0x10, 0x02, 0x00, 0x00, 0x0d, 0x38, 0x00, 0x00, 0x02, 0x08, 0x00, 0x00, 0x13, 0x20, 0x00, 0x00, 0x0e, 0x14, 0x00, 0x00, 0x02, 0x11, 0x08, 0x01, 0x00, 0x00, 0x11, 0x40,
+  0x85, 0x02, 0x00, 0x00, 0x0c, 0x1a, 0x00, 0x00, 0x02, 0x23, 0x02, 0x80, 0x00, 0x00, 0x0c, 0x08, 0x00, 0x00, 0x03, 0x04, 0x00, 0x00, 0x0d, 0x02, 0x00, 0x00, 0x02, 0x80, 0x00, 0x58, 0x00, 0x00,
+  0x0c, 0x01, 0x00, 0x00, 0x03, 0x03, 0x24, 0x00, 0x00, 0x0c, 0x0f, 0x00, 0x00, 0x01, 0x01, 0x00, 0x0c, 0x33, 0x00, 0x00, 0x0c, 0x04, 0x80, 0x00, 0x00, 0x01, 0x03, 0x00, 0x09, 0x00, 0x00, 0x0d,
+  0xc0, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xc4, 0x00, 0x00, 0x0c, 0x04, 0x00, 0x00, 0x01, 0x05, 0x86, 0x01, 0x83, 0x00, 0x00, 0x0c, 0x03, 0x60, 0x00, 0x00, 0x00, 0x02, 0x40, 0x00, 0x00,
+  0x0e, 0x02, 0x00, 0x00, 0x01, 0x08, 0x80, 0x00, 0x00, 0x0f, 0x30, 0x00, 0x00, 0x00, 0x05, 0x00, 0x01, 0x00, 0x00, 0x0d, 0x02, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00,
+  0x0c, 0x01, 0x90, 0x00, 0x00, 0x00, 0x28, 0x06, 0x03, 0x00, 0x00, 0x0d, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x10, 0x02, 0x00, 0x00, 0x01, 0x0c, 0x00, 0x00, 0x0e, 0x01, 0x05, 0x00,
+  0x00, 0x00, 0xa0, 0x00, 0x00, 0x10, 0xc2, 0x80, 0x01, 0x40, 0x00, 0x03, 0x00, 0x00, 0x0e, 0x81, 0x40, 0x02, 0x80, 0x00, 0x06, 0x00, 0x00, 0x0f, 0xa0, 0x05, 0x00, 0x00, 0x12, 0x50, 0x1a, 0x00,
+  0x08, 0x00, 0x00, 0x0f, 0xc0, 0x0f, 0xe4, 0x40, 0x04, 0x00, 0x00, 0x0f, 0x20, 0x00, 0x10, 0x00, 0x10, 0x06, 0x00, 0x00, 0x0e, 0x40, 0x0f, 0xf0, 0x00, 0x08, 0x0c, 0x00, 0x00, 0x0f, 0x04, 0x00,
+  0x01, 0x00, 0x00, 0x10, 0x60, 0x00, 0x28, 0x00, 0x80, 0x00, 0x00, 0x0f, 0x10, 0x03, 0xc0, 0x01, 0x00, 0x00, 0x10, 0x20, 0x34, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x0f, 0x02, 0x00, 0x00,
+  0x00, 0x18, 0x1c, 0x00, 0x00, 0x0f, 0x09, 0x70, 0x00, 0x00, 0x11, 0x30, 0x00, 0x80, 0x02, 0x30, 0x00, 0x00, 0x0f, 0x18, 0x00, 0x04, 0x00, 0x00, 0x12, 0x10, 0x08, 0x00, 0x00, 0x12, 0x08, 0x00,
+  0x00, 0x01, 0x18, 0x00, 0x00, 0x10, 0x02, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x0e, 0x18, 0x00, 0x04, 0x00, 0x00, 0x11, 0x04, 0x06, 0x00, 0x00, 0x12, 0x08, 0x0b, 0x38, 0x00, 0x20, 0x00, 0x00,
+  0x10, 0x02, 0xc4, 0x00, 0x10, 0x20, 0x00, 0x00, 0x0f, 0x02, 0x90, 0x00, 0x60, 0x10, 0x00, 0x00, 0x0e, 0x0c, 0x05, 0x08, 0x03, 0x00, 0x60, 0x00, 0x00, 0x0e, 0x02, 0x00, 0x06, 0x00, 0x00, 0x11,
+  0x04, 0x18, 0x00, 0x00, 0x2d, 0x40, 0x00, 0x00, 0x11, 0x06, 0x00, 0x20, 0x00, 0x00, 0x0e, 0x07, 0x00, 0x40, 0x00, 0x60, 0xc0, 0x00, 0x00, 0x0e, 0x02, 0x0c, 0x00, 0x00, 0x16, 0xc0, 0x00, 0x00,
+  0x2a, 0xc0, 0x00, 0x00, 0x24, 0x03, 0x80, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x0e, 0x01, 0x00, 0x00, 0x2d, 0xc0, 0x00, 0x00, 0x12, 0x06, 0x01, 0x00, 0x00, 0x10, 0x0c, 0x00, 0x00, 0x01,
+  0x80, 0x00, 0x00, 0x0e, 0x01, 0x80, 0x20, 0x01, 0x83, 0x00, 0x00, 0x10, 0xc0, 0x00, 0x00, 0x2b, 0x08, 0x00, 0x00, 0x12, 0x10, 0x04, 0x00, 0x00, 0x11, 0x06, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00,
+  0x26, 0xc0, 0x00, 0x01, 0x86, 0x00, 0x00, 0x10, 0x60, 0x00, 0x00, 0x2a, 0x20, 0x00, 0x00, 0x14, 0x01, 0x06, 0x00, 0x00, 0x12, 0x02, 0x00, 0x00, 0x13, 0x0c, 0x00, 0x00, 0x11, 0x66, 0x00, 0x00,
+  0x00, 0x0c, 0x00, 0x00, 0x26, 0x30, 0x00, 0x00, 0x2b, 0x03, 0x0c, 0x00, 0x00, 0x12, 0x08, 0x00, 0x00, 0x13, 0x50, 0x00, 0x00, 0x14, 0x18, 0x00, 0x00, 0x10, 0x33, 0x00, 0x00, 0x15, 0x02, 0x00,
+  0x00, 0x11, 0x08, 0x00, 0x04, 0x00, 0x00, 0x11, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x13, 0x10, 0x00, 0x00, 0x12, 0x08, 0x00, 0x00, 0x13, 0x10, 0x00, 0x00, 0x11, 0x02, 0x00, 0x00, 0x00,
+  0x30, 0x00, 0x00, 0x10, 0x09, 0x00, 0x06, 0x00, 0x00, 0x11, 0x10, 0x00, 0x00, 0x2c, 0x20, 0x00, 0x00, 0x10, 0x0c, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x12, 0x30, 0x00, 0x00, 0x14, 0x20, 0x00,
+  0x00, 0x13, 0x40, 0x00, 0x00, 0x12, 0x0c, 0x00, 0x00, 0x11, 0x01, 0x80, 0x00, 0x00, 0x12, 0x0c, 0x00, 0x00, 0x16, 0x60, 0x00, 0x00, 0x11, 0xa0, 0x30, 0x00, 0x00, 0x12, 0x80, 0x00, 0x00, 0x12,
+  0x04, 0x10, 0x0c, 0x00, 0x00, 0x11, 0x02, 0x00, 0x00, 0x00, 0xc0, 0x00, 0x00, 0x10, 0x01, 0x80, 0x00, 0x00, 0x41, 0x80, 0x00, 0x00, 0x12, 0x60, 0x40, 0x00, 0x00, 0x10, 0x04, 0x00, 0x00, 0x13,
+  0x02, 0x08, 0x20, 0x00, 0x00, 0x13, 0x20, 0x00, 0x00, 0x14, 0x80, 0x00, 0x00, 0x11, 0x10, 0x69, 0x00, 0x00, 0x13, 0x19, 0x80, 0x00, 0x00, 0x10, 0x03, 0x00, 0x91, 0x80, 0x00, 0x00, 0x11, 0x40,
+  0x01, 0x80, 0x00, 0x00, 0x11, 0x01, 0x10, 0x00, 0x00, 0x12, 0x40, 0x00, 0x00, 0x14, 0x10, 0x00, 0x00, 0x29, 0x01, 0x00, 0x00, 0x13, 0x41, 0x00, 0x00, 0x11, 0x03, 0x00, 0xc0, 0x00, 0x00, 0x28,
+  0x01, 0x01, 0x00, 0x00, 0x00, 0x13, 0x01, 0x00, 0x00, 0x12, 0x01, 0x00, 0x00, 0x29, 0x10, 0x00, 0x00, 0x13, 0x09, 0x00, 0x00, 0x12, 0x01, 0x80, 0x00, 0x00, 0x55, 0x80, 0x00, 0x00, 0x13, 0x80,
+  0x00, 0x00, 0x3e, 0x01, 0x80, 0x00, 0x00, 0x4b, 0x03, 0x80, 0xff, 0xff, 0x12, 0x0c, 0x60, 0x00, 0x00, 0x12, 0x13, 0x90, 0x00, 0x00, 0x12, 0x04, 0x48, 0x00, 0x00, 0x12, 0x28, 0x30, 0x00, 0x00,
+  0x13, 0x04, 0x00, 0x00, 0x12, 0x50, 0x00, 0x00, 0x13, 0x2c, 0x6a, 0x00, 0x00, 0x13, 0x10, 0x00, 0x00, 0x12, 0x92, 0x04, 0x00, 0x00, 0x12, 0x04, 0x20, 0x00, 0x00, 0x12, 0x48, 0xc0, 0x00, 0x00,
+  0x3e, 0x12, 0x93, 0x00, 0x00, 0x55, 0x03, 0x00, 0x00, 0x29, 0x10, 0x00, 0x00, 0x12, 0x58, 0x00, 0x00, 0x13, 0x10, 0x20, 0x00, 0x00, 0x12, 0x86, 0x54, 0x00, 0x00, 0x12, 0x09, 0x80, 0x00, 0x00,
+  0x12, 0x24, 0x2a, 0x00, 0x00, 0x12, 0x43, 0xc0, 0x00, 0x00, 0x12, 0x10, 0x04, 0x00, 0x00, 0x12, 0x28, 0x30, 0x00, 0x00, 0x12, 0x04, 0x48, 0x00, 0x00, 0x12, 0x13, 0x90, 0x00, 0x00, 0x12, 0x0c,
+  0x60, 0x00, 0x00, 0x12
+};
+size_t images_atlas_len = 4356;
+
@@ -0,0 +1,61 @@
+#include "atlas.h"
+#include "rle.h"
+
+// Size of the table entry of every image: its x, y, width and height, as 16-bit
+// little endian integers
+#define ATLAS_ENTRY_SIZE 8
+
+/*
+ * Reads a 16-bit little endian integer.
+ */
+static uint16_t read_u16(const uint8_t* data);
+
+uint16_t read_u16(const uint8_t* data) {
+    return data[0] | data[1] << 8;
+}
+
+bool load_atlas(const uint8_t* data, size_t size, void* buf, size_t buf_size, struct PbmImage* images, uint8_t image_count) {
+    struct PbmImage atlas;
+    size_t table_size = 1 + image_count * ATLAS_ENTRY_SIZE;
+
+    if (size <= table_size || data[0] != image_count) {
+        return false;
+    }
+
+    // The whole atlas is a single compressed stream, so it is decoded at once
+    size_t atlas_size = decompress((void*) (data + table_size), size - table_size, buf, buf_size);
+    if (atlas_size == 0) {
+        return false;
+    }
+
+    atlas.width = 0;
+    decode_pbm(buf, atlas_size, &atlas);
+    if (atlas.width == 0) {
+        return false;
+    }
+
+#if ROW_DELTA
+    undo_pbm_row_delta(&atlas);
+#endif
+
+    for (uint8_t i = 0; i < image_count; ++i) {
+        const uint8_t* entry = data + 1 + i * ATLAS_ENTRY_SIZE;
+        uint16_t x = read_u16(entry);
+        uint16_t y = read_u16(entry + 2);
+        uint16_t width = read_u16(entry + 4);
+        uint16_t height = read_u16(entry + 6);
+
+        // Images start at byte boundaries, so their rows can be addressed like
+        // the ones of standalone images
+        if (x % 8 != 0 || x + width > atlas.width || y + height > atlas.height) {
+            return false;
+        }
+
+        images[i].width = width;
+        images[i].height = height;
+        images[i].raster_pos = (uint8_t*) atlas.raster_pos + y * atlas.row_bytes + x / 8;
+        images[i].row_bytes = atlas.row_bytes;
+    }
+
+    return true;
+}
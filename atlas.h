@@ -0,0 +1,16 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include "pbm_decoder.h"
+
+/*
+ * Decompresses an image atlas generated by the atlas packer in util to the
+ * specified buffer, as a single PBM image, and undoes the row delta pre-filter
+ * if the assets were built with it. Then every image of the array is set to its
+ * rectangle of the atlas, in the order the images were given to the packer.
+ * The palettes of the images are not changed. Returns false if the atlas is not
+ * valid, it doesn't have image_count images, or it doesn't fit in the buffer.
+ */
+bool load_atlas(const uint8_t* data, size_t size, void* buf, size_t buf_size, struct PbmImage* images, uint8_t image_count);
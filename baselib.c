@@ -1,6 +1,11 @@
 #include "baselib.h"
 #include "interrupts.h"
 
+// Where the BIOS keeps its data. Hosted builds, like the simulator, may define it elsewhere
+#ifndef BIOS_DATA_AREA_ADDRESS
+#define BIOS_DATA_AREA_ADDRESS 0x0400
+#endif
+
 static bool prng_seeded = false;
 static uint64_t prng_seed;
 
@@ -18,6 +23,12 @@ inline void outb(uint16_t port, uint8_t value) {
 	__asm__ volatile("OUTB %0, %1" :: "dN"(port), "a"(value));
 }
 
+inline uint8_t inb(uint16_t port) {
+	uint8_t value;
+	__asm__ volatile("IN %0, %1" : "=a"(value) : "dN"(port));
+	return value;
+}
+
 void approximate_udelay(uint16_t usecs) {
 	while (usecs--) {
 		// 0x80 port is used for POST codes,
@@ -43,11 +54,43 @@ bool isspace(char c) {
 	return c == ' ' || c == '\t' || c == '\n' || c == '\v' || c == '\f' || c == '\r';
 }
 
+void* memcpy(void* dest, const void* src, size_t size) {
+	void* dest_ptr = dest;
+	size_t dwords = size / 4;
+
+	// Copy double words first, and then the remaining bytes
+	__asm__ volatile(
+		"REP MOVSD\n\t"
+		"MOV ecx, %3\n\t"
+		"REP MOVSB"
+		: "+D"(dest_ptr), "+S"(src), "+c"(dwords)
+		: "r"(size & 3)
+		: "memory"
+	);
+
+	return dest;
+}
+
+void* memset(void* dest, int value, size_t size) {
+	void* dest_ptr = dest;
+
+	__asm__ volatile(
+		"REP STOSB"
+		: "+D"(dest_ptr), "+c"(size)
+		: "a"(value)
+		: "memory"
+	);
+
+	return dest;
+}
+
 uint32_t rand(void) {
 	if (!prng_seeded) {
 		// Get pseudorandom bits by using data left over by the EBDA,
 		// which should be pretty unique
-		prng_seed = 12229904691154926667UL ^ (*(uint64_t*) 0x046C) ^ (*(uint64_t*) 0x0497) ^ (*(uint64_t*) 0x0410);
+		uint8_t* bios_data_area = (uint8_t*) BIOS_DATA_AREA_ADDRESS;
+		prng_seed = 12229904691154926667UL ^ *(uint64_t*) (bios_data_area + 0x6C) ^
+			*(uint64_t*) (bios_data_area + 0x97) ^ *(uint64_t*) (bios_data_area + 0x10);
 
 		prng_seeded = true;
 	}
@@ -15,6 +15,11 @@ void halt(bool forever);
  */
 void outb(uint16_t port, uint8_t value);
 
+/*
+ * Reads a byte value from an I/O port.
+ */
+uint8_t inb(uint16_t port);
+
 /*
  * Delays execution for the specified number of microseconds, approximately, depending
  * on the underlying 0x80 I/O port characteristics. This function is only suitable for
@@ -37,6 +42,18 @@ unsigned int strtoui(uint8_t** s, size_t size);
  */
 bool isspace(char c);
 
+/*
+ * Copies size bytes from src to dest, which must not overlap. It works just like
+ * the memcpy standard C library function.
+ */
+void* memcpy(void* dest, const void* src, size_t size);
+
+/*
+ * Sets the first size bytes pointed to by dest to the specified value. It works
+ * just like the memset standard C library function.
+ */
+void* memset(void* dest, int value, size_t size);
+
 /*
  * Generates a random integer between 0 and 2^32 - 1, inclusive.
  */
@@ -0,0 +1,233 @@
+#!/usr/bin/env python3
+"""
+Boots a disk image built with BENCHMARK=1 in headless QEMU, and measures it.
+
+The payload of such images reports through COM1 every phase change, as
+"phase <number>", and how long every frame took to draw, as
+"frame <phase> <nanoseconds> <time>", with hexadecimal numbers. The time is the
+number of nanoseconds since the CPU was reset when the frame was done, as told
+by the guest clock, without the time spent waiting for the host. At every phase change
+it waits for a byte from the host, so a screenshot of a known screen can be
+taken meanwhile.
+
+The boot to first frame latency, which is the time of the first frame, per-phase frame times and screenshot checksums
+are compared against a stored baseline. The run fails if the latency regresses
+beyond a threshold, or if any screenshot differs.
+"""
+
+import argparse
+import hashlib
+import json
+import os
+import socket
+import subprocess
+import sys
+import tempfile
+import time
+
+BASELINE_PATH = os.path.join(os.path.dirname(os.path.abspath(__file__)), 'baseline.json')
+
+# Phases of the show. The last one repeats forever, so measuring stops after a
+# few frames of it
+PHASE_COUNT = 4
+LAST_PHASE_FRAMES = 5
+
+
+class Qmp:
+    """Minimal QEMU Machine Protocol client."""
+
+    def __init__(self, path):
+        self.socket = socket.socket(socket.AF_UNIX, socket.SOCK_STREAM)
+        self.socket.connect(path)
+        self.file = self.socket.makefile('rw')
+        self._read()  # Greeting
+        self.execute('qmp_capabilities')
+
+    def _read(self):
+        line = self.file.readline()
+        if not line:
+            raise RuntimeError('QMP connection closed')
+        return json.loads(line)
+
+    def execute(self, command, **arguments):
+        message = {'execute': command}
+        if arguments:
+            message['arguments'] = arguments
+        self.file.write(json.dumps(message) + '\n')
+        self.file.flush()
+
+        # Skip asynchronous events until the command response arrives
+        while True:
+            response = self._read()
+            if 'error' in response:
+                raise RuntimeError('QMP {} failed: {}'.format(command, response['error']))
+            if 'return' in response:
+                return response['return']
+
+
+def connect_when_ready(path, connect, deadline):
+    while True:
+        try:
+            return connect(path)
+        except (FileNotFoundError, ConnectionRefusedError):
+            if time.monotonic() > deadline:
+                raise
+            time.sleep(0.05)
+
+
+def connect_serial(path):
+    serial = socket.socket(socket.AF_UNIX, socket.SOCK_STREAM)
+    serial.connect(path)
+    return serial
+
+
+def sha256(path):
+    with open(path, 'rb') as file:
+        return hashlib.sha256(file.read()).hexdigest()
+
+
+def run(args, work_dir):
+    qmp_path = os.path.join(work_dir, 'qmp.sock')
+    serial_path = os.path.join(work_dir, 'serial.sock')
+    os.makedirs(args.screenshots, exist_ok=True)
+
+    qemu = subprocess.Popen([
+        args.qemu, '-display', 'none', '-S', '-no-reboot',
+        '-drive', 'file={},format=raw'.format(args.image),
+        '-chardev', 'socket,id=com1,path={},server=on,wait=off'.format(serial_path),
+        '-serial', 'chardev:com1',
+        '-qmp', 'unix:{},server=on,wait=off'.format(qmp_path),
+    ])
+
+    try:
+        deadline = time.monotonic() + args.timeout
+        qmp = connect_when_ready(qmp_path, Qmp, deadline)
+        serial = connect_when_ready(serial_path, connect_serial, deadline)
+
+        results = {'boot_to_first_frame_ms': None, 'phases': {}}
+        buffer = b''
+
+        # The machine starts stopped, so nothing is missed before connecting
+        qmp.execute('cont')
+
+        while True:
+            remaining = deadline - time.monotonic()
+            if remaining <= 0:
+                raise RuntimeError('Timed out waiting for the payload')
+
+            serial.settimeout(remaining)
+            data = serial.recv(4096)
+            if not data:
+                raise RuntimeError('QEMU closed the serial port')
+
+            buffer += data
+            *lines, buffer = buffer.split(b'\n')
+
+            for line in lines:
+                fields = line.decode('ascii', 'replace').split()
+
+                if len(fields) == 2 and fields[0] == 'phase':
+                    phase = str(int(fields[1], 16))
+                    screenshot = os.path.abspath(os.path.join(args.screenshots, 'phase_{}.ppm'.format(phase)))
+
+                    qmp.execute('screendump', filename=screenshot)
+                    results['phases'][phase] = {'frame_times_ns': [], 'screenshot_sha256': sha256(screenshot)}
+
+                    serial.sendall(b'\n')
+                elif len(fields) == 4 and fields[0] == 'frame':
+                    # Measured by the guest, so QEMU startup and serial latency don't count
+                    if results['boot_to_first_frame_ms'] is None:
+                        results['boot_to_first_frame_ms'] = int(fields[3], 16) / 1e6
+
+                    phase = results['phases'][str(int(fields[1], 16))]
+                    phase['frame_times_ns'].append(int(fields[2], 16))
+
+            last_phase = results['phases'].get(str(PHASE_COUNT))
+            if last_phase is not None and len(last_phase['frame_times_ns']) >= LAST_PHASE_FRAMES:
+                break
+
+        qmp.execute('quit')
+    finally:
+        try:
+            qemu.wait(timeout=5)
+        except subprocess.TimeoutExpired:
+            qemu.kill()
+
+    for phase in results['phases'].values():
+        times = phase.pop('frame_times_ns')
+        phase['frames'] = len(times)
+        phase['mean_frame_ms'] = sum(times) / len(times) / 1e6 if times else 0
+        phase['max_frame_ms'] = max(times) / 1e6 if times else 0
+
+    return results
+
+
+def change(current, baseline):
+    if not baseline:
+        return ''
+    return ' ({:+.1f} %)'.format((current - baseline) * 100 / baseline)
+
+
+def compare(results, baseline, threshold):
+    """Prints the results next to the baseline ones. Returns whether they regressed."""
+    failed = False
+    latency = results['boot_to_first_frame_ms']
+    baseline_latency = baseline.get('boot_to_first_frame_ms')
+
+    print('Boot to first frame: {:.1f} ms{}'.format(latency, change(latency, baseline_latency)))
+    if baseline_latency and latency > baseline_latency * (1 + threshold / 100):
+        print('   Regressed more than {} %'.format(threshold))
+        failed = True
+
+    for number, phase in sorted(results['phases'].items()):
+        baseline_phase = baseline.get('phases', {}).get(number, {})
+        print('Phase {}: {} frames, {:.3f} ms mean{}, {:.3f} ms max{}'.format(
+            number, phase['frames'],
+            phase['mean_frame_ms'], change(phase['mean_frame_ms'], baseline_phase.get('mean_frame_ms')),
+            phase['max_frame_ms'], change(phase['max_frame_ms'], baseline_phase.get('max_frame_ms'))
+        ))
+
+        baseline_checksum = baseline_phase.get('screenshot_sha256')
+        if baseline_checksum is not None and baseline_checksum != phase['screenshot_sha256']:
+            print('   Screenshot differs from the baseline one')
+            failed = True
+
+    return failed
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('image', help='disk image built with BENCHMARK=1')
+    parser.add_argument('--qemu', default='qemu-system-i386', help='QEMU executable')
+    parser.add_argument('--baseline', default=BASELINE_PATH, help='baseline results file')
+    parser.add_argument('--update-baseline', action='store_true', help='store the results as the new baseline')
+    parser.add_argument('--threshold', type=float, default=10, help='boot to first frame latency regression allowed, in percent')
+    parser.add_argument('--timeout', type=float, default=120, help='seconds to wait for the payload')
+    parser.add_argument('--screenshots', help='directory for the screenshots. Default: next to the image')
+    args = parser.parse_args()
+
+    if args.screenshots is None:
+        args.screenshots = os.path.join(os.path.dirname(os.path.abspath(args.image)), 'screenshots')
+
+    with tempfile.TemporaryDirectory() as work_dir:
+        results = run(args, work_dir)
+
+    baseline = {}
+    if os.path.exists(args.baseline):
+        with open(args.baseline) as file:
+            baseline = json.load(file)
+
+    failed = compare(results, baseline, args.threshold)
+
+    if args.update_baseline or not baseline:
+        with open(args.baseline, 'w') as file:
+            json.dump(results, file, indent=4, sort_keys=True)
+            file.write('\n')
+        print('Baseline stored in {}'.format(args.baseline))
+        failed = False
+
+    return 1 if failed else 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
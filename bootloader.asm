@@ -4,15 +4,31 @@ CPU 386
 ; 0x7C00. No guarantee about on which segment it is
 ORG 0x7C00
 
+; Number of payload sectors to load. The Makefile passes
+; the actual size of the payload stored on disk
+%ifndef PAYLOAD_SECTORS
+	%define PAYLOAD_SECTORS 24
+%endif
+
+; Benchmark builds start the payload right away, without user interaction
+%ifndef BENCHMARK
+	%define BENCHMARK 0
+%endif
+
 ; When this bootloader hands over execution to C code,
 ; the following variables are guaranteed to be available
 ; in the specified memory addresses:
 ; 0x0500 - 0x06FF: VbeInfoBlock (512 bytes)
 ; 0x0700 - 0x07FF: ModeInfoBlock (256 bytes)
 ; 0x0800 - 0x080B: temporary itoa buffers (12 bytes)
+; 0x0900 - 0x0F03: E820 memory map. A 32-bit entry count
+;                  followed by up to 64 entries of 24 bytes
 ; ??? - 0x7BFF: stack (grows backwards)
 ; 0x7C00 - 0x7FFF: bootloader code (1 KiB)
 ; 0x8000 - 0x7FFFF: C code (480 KiB maximum)
+; If the payload is compressed, a stub at 0x8000 unpacks it in place
+; before C code executes, using 0x70000 - 0x73FFF as scratch memory.
+; 0x100000 - ???: usable RAM, as described by the E820 memory map
 ; When C code executes, interrupts are disabled. It is responsible
 ; for setting up a IDT and enabling them, if needed.
 
@@ -86,7 +102,7 @@ mbr:
 	; It is assumed that a track has at least
 	; two sectors in it
 	MOV ah, 0x02
-	MOV al, 23 ; One sector for second stage + 22 sectors for C payload (11 KiB)
+	MOV al, 1 + PAYLOAD_SECTORS ; One sector for second stage + C payload sectors (12 KiB maximum)
 	MOV ch, 0 ; First cylinder (track)
 	MOV dh, 0 ; First head
 	MOV cl, 2 ; Second sector
@@ -290,6 +306,7 @@ second_stage:
 	; Print header string
 	XOR ax, ax ; Clear accumulator
 	MOV ds, ax
+	CALL detect_memory
 	MOV si, selected_mode
 	CALL puts
 	MOV al, ' '
@@ -364,12 +381,14 @@ second_stage:
 		JMP freeze
 
 	.set_mode:
+%if !BENCHMARK
 		MOV si, video_mode_found
 		CALL puts
 
 		; Wait for keystroke
 		XOR ah, ah
 		INT 0x16
+%endif
 
 		MOV al, `\r`
 		CALL putchar
@@ -414,6 +433,38 @@ second_stage:
 ; Functions
 ; ---------
 
+; Stores the BIOS memory map at 0x0900, using "INT 15h, EAX=E820h -
+; Query System Address Map". The entry count is left at zero if the
+; BIOS does not support this function. DS is assumed to be zero.
+detect_memory:
+	XOR ebx, ebx ; Continuation value, zero for the first call
+	MOV es, bx
+	MOV dword [0x0900], ebx
+	MOV di, 0x0904
+
+	.loop:
+		MOV eax, 0xE820
+		MOV ecx, 24
+		MOV edx, 0x534D4150 ; 'SMAP'
+		; Mark the entry as valid in case the BIOS does not
+		; return ACPI 3.0 extended attributes
+		MOV dword [es:di + 20], 1
+		INT 0x15
+		JC .return ; Not supported, or past the last entry
+		CMP eax, 0x534D4150
+		JNE .return
+
+		INC dword [0x0900]
+		ADD di, 24
+
+		TEST ebx, ebx
+		JZ .return ; That was the last entry
+		CMP di, 0x0904 + 64 * 24
+		JB .loop ; Stop when the handoff area is full
+
+	.return:
+		RET
+
 ; Function adapted from https://wiki.osdev.org/A20_Line#Testing_the_A20_line
 enable_a20:
 	MOV ax, 0xFFFF
@@ -0,0 +1,185 @@
+#include <stdbool.h>
+
+#include "clock.h"
+#include "baselib.h"
+#include "interrupts.h"
+
+#define PIT_CHANNEL_2_DATA 0x42
+#define PIT_CHANNEL_2_CONTROL 0x61 // Gate on bit 0, output on bit 5 (shared with PC speaker)
+#define MASTER_PIC_COMMAND 0x20
+
+#define EFLAGS_IF (1UL << 9)
+#define EFLAGS_ID (1UL << 21)
+#define CPUID_TSC (1UL << 4)
+
+// PIT counts to calibrate the TSC with. About 10 ms
+#define CALIBRATION_COUNT (PIT_FREQUENCY / 100)
+#define CALIBRATION_NS ((uint32_t) ((uint64_t) CALIBRATION_COUNT * 1000000000 / PIT_FREQUENCY))
+// Reads of the channel 2 output after which calibration is given up. A read takes
+// about a microsecond on ISA hardware, and much less in emulators
+#define CALIBRATION_MAX_POLLS (1UL << 20)
+
+// Nanoseconds per PIT count, as a fixed point number with 16 fractional bits
+#define PIT_COUNT_NS_FIXED ((uint32_t) (((uint64_t) 1000000000 << 16) / PIT_FREQUENCY))
+
+static bool tsc_available = false;
+// Nanoseconds are computed as (TSC cycles * tsc_mult) >> tsc_shift
+static uint32_t tsc_mult;
+static uint8_t tsc_shift;
+
+static uint64_t last_ns = 0;
+
+/*
+ * Checks whether the CPU supports the CPUID instruction and reports a time stamp counter.
+ */
+static bool detect_tsc(void);
+
+/*
+ * Returns the current value of the time stamp counter.
+ */
+static uint64_t read_tsc(void);
+
+/*
+ * Divides a 64-bit integer by a 32-bit one. The quotient must fit in 32 bits,
+ * or a CPU exception is raised.
+ */
+static uint32_t divide(uint64_t dividend, uint32_t divisor);
+
+bool detect_tsc(void) {
+	uint32_t original_flags;
+	uint32_t toggled_flags;
+
+	// CPUID is supported if the ID flag can be toggled
+	__asm__ volatile(
+		"PUSHFD\n\t"
+		"POP %0\n\t"
+		"MOV %1, %0\n\t"
+		"XOR %1, %2\n\t"
+		"PUSH %1\n\t"
+		"POPFD\n\t"
+		"PUSHFD\n\t"
+		"POP %1\n\t"
+		"PUSH %0\n\t"
+		"POPFD"
+		: "=&r"(original_flags), "=&r"(toggled_flags)
+		: "i"(EFLAGS_ID)
+		: "cc"
+	);
+
+	if (((original_flags ^ toggled_flags) & EFLAGS_ID) == 0) {
+		return false;
+	}
+
+	uint32_t max_leaf;
+	uint32_t features;
+	__asm__ volatile("CPUID" : "=a"(max_leaf) : "a"(0) : "ebx", "ecx", "edx");
+	if (max_leaf < 1) {
+		return false;
+	}
+
+	__asm__ volatile("CPUID" : "=d"(features) : "a"(1) : "ebx", "ecx");
+	return (features & CPUID_TSC) != 0;
+}
+
+uint64_t read_tsc(void) {
+	uint64_t tsc;
+	__asm__ volatile("RDTSC" : "=A"(tsc));
+	return tsc;
+}
+
+uint32_t divide(uint64_t dividend, uint32_t divisor) {
+	uint32_t quotient;
+	uint32_t remainder;
+	__asm__("DIV %2" : "=a"(quotient), "=d"(remainder) : "rm"(divisor), "A"(dividend));
+	return quotient;
+}
+
+void setup_clock(void) {
+	if (detect_tsc()) {
+		uint8_t port_state = inb(PIT_CHANNEL_2_CONTROL);
+
+		// Raise the gate of PIT channel 2, with the speaker disconnected, and make
+		// it count down once. Its output goes high when the count reaches zero
+		outb(PIT_CHANNEL_2_CONTROL, (port_state & 0xFD) | 0x01);
+		outb(PIT_COMMAND, 0xB0); // LO/HI access mode, interrupt on terminal count, channel 2
+		outb(PIT_CHANNEL_2_DATA, CALIBRATION_COUNT & 0xFF);
+		outb(PIT_CHANNEL_2_DATA, CALIBRATION_COUNT >> 8);
+
+		// Some chipsets and emulators don't reflect the output in the control port,
+		// so give up after many more reads than the count takes
+		uint32_t polls = CALIBRATION_MAX_POLLS;
+		uint64_t start_tsc = read_tsc();
+		while ((inb(PIT_CHANNEL_2_CONTROL) & 0x20) == 0 && --polls != 0);
+		uint32_t elapsed_tsc = read_tsc() - start_tsc;
+
+		outb(PIT_CHANNEL_2_CONTROL, port_state);
+
+		if (polls != 0 && elapsed_tsc != 0) {
+			// Use as many fractional bits as possible, as long as the multiplier fits in 32 bits
+			tsc_shift = 32;
+			while (((uint64_t) CALIBRATION_NS << tsc_shift) >> 32 >= elapsed_tsc) {
+				--tsc_shift;
+			}
+			tsc_mult = divide((uint64_t) CALIBRATION_NS << tsc_shift, elapsed_tsc);
+
+			tsc_available = true;
+			return;
+		}
+	}
+
+	// The fallback reads PIT channel 0, which counts down from the reload value
+	// the BIOS set until setup_interrupts programs it, so program it now. The
+	// mode and reload value must match the ones setup_interrupts uses
+	outb(PIT_COMMAND, 0x34); // LO/HI access mode, rate generator, channel 0
+	outb(PIT_DATA, PIT_RELOAD & 0xFF);
+	outb(PIT_DATA, PIT_RELOAD >> 8);
+}
+
+uint64_t now_ns(void) {
+	uint64_t ns;
+	uint32_t flags;
+
+	// The PIT counter and tick count must be read atomically
+	__asm__ volatile("PUSHFD\n\tPOP %0\n\tCLI" : "=r"(flags) :: "memory");
+
+	if (tsc_available) {
+		// The time stamp counter starts counting when the CPU is reset
+		uint64_t cycles = read_tsc();
+
+		// 96-bit product, split in two 64-bit ones
+		ns = (((uint64_t) (uint32_t) (cycles >> 32) * tsc_mult) << (32 - tsc_shift)) +
+			(((uint64_t) (uint32_t) cycles * tsc_mult) >> tsc_shift);
+	} else {
+		outb(PIT_COMMAND, 0x00); // Latch channel 0 count
+		uint16_t count = inb(PIT_DATA);
+		count |= inb(PIT_DATA) << 8;
+
+		// A count above the reload value can only come from a different reload
+		// value, and would make the elapsed counts negative
+		if (count > PIT_RELOAD) {
+			count = PIT_RELOAD;
+		}
+
+		uint64_t ticks = get_tick_count();
+
+		// If the counter was reloaded but its interrupt was not serviced yet,
+		// count that tick too. OCW3 0x0A selects the interrupt request register
+		outb(MASTER_PIC_COMMAND, 0x0A);
+		if ((inb(MASTER_PIC_COMMAND) & 0x01) != 0 && count > PIT_RELOAD / 2) {
+			++ticks;
+		}
+
+		ns = ((ticks * PIT_RELOAD + (PIT_RELOAD - count)) * PIT_COUNT_NS_FIXED) >> 16;
+	}
+
+	if (ns < last_ns) {
+		ns = last_ns;
+	}
+	last_ns = ns;
+
+	if ((flags & EFLAGS_IF) != 0) {
+		sti();
+	}
+
+	return ns;
+}
@@ -0,0 +1,24 @@
+#pragma once
+
+#include <stdint.h>
+
+#define NS_PER_MS 1000000
+
+/*
+ * Initializes the monotonic clock. If the CPU has a time stamp counter, its
+ * frequency is calibrated against the PIT, which takes about 10 ms. Otherwise,
+ * or if calibration fails, the clock falls back to latching the PIT channel 0
+ * counter, which is programmed here with the same reload value as
+ * setup_interrupts, and which requires interrupts to be configured for it to
+ * advance past a tick. This function should be called only once, before any
+ * other clock function.
+ */
+void setup_clock(void);
+
+/*
+ * Returns the number of nanoseconds elapsed since the CPU was reset, as counted
+ * by the time stamp counter, or since the clock was set up if it is not used. The
+ * returned values never decrease. Resolution is that of the time stamp counter
+ * if it is used, and about 838 ns (a PIT counter decrement) otherwise.
+ */
+uint64_t now_ns(void);
@@ -0,0 +1,566 @@
+#include "compositor.h"
+#include "vbe.h"
+
+// Composed pixels of the scanline being drawn, as 0x00RRGGBB, indexed by screen
+// column. 10 KiB, which is enough for the maximum resolution the bootloader
+// accepts (2550 pixels)
+static uint32_t* line = (uint32_t*) 0x7A0F0;
+
+// Source column tables of the layers, one per layer in the order they are added.
+// 5 KiB each, which is enough for the maximum resolution the bootloader accepts
+static uint16_t* column_tables = (uint16_t*) 0x60EF0;
+#define COLUMN_TABLE_SIZE 2560
+
+// Blending weight of fully opaque pixels, in 1/256 units
+#define OPAQUE_WEIGHT 256
+
+// Layers, sorted from the bottom one to the top one
+static struct Layer* layers[COMPOSITOR_MAX_LAYERS];
+static uint8_t layer_count = 0;
+
+// Screen rectangles that must be drawn again
+static struct Rect dirty_rects[REGION_MAX_RECTS];
+static uint16_t dirty_rect_count = 0;
+static struct Region dirty_region;
+
+/*
+ * Adds a rectangle to the ones that must be drawn again, unless one of them already
+ * contains it. If there is no room for it, the last rectangle grows to contain it.
+ */
+static void mark_dirty(const struct Rect* rect);
+
+/*
+ * Marks the screen area a layer covers as dirty. For layers with a clip region,
+ * that is the part of its rectangles inside the layer bounds.
+ */
+static void mark_layer_dirty(const struct Layer* layer);
+
+/*
+ * Computes the screen rectangle a layer covers, clipped to the screen, and the source
+ * column of each of its screen columns, for image layers.
+ */
+static void compute_bounds(struct Layer* layer);
+
+/*
+ * Returns the 16.16 fixed point step in the source for each destination element,
+ * when scaling by the specified scale factor.
+ */
+static uint32_t scale_step(uint16_t scale);
+
+/*
+ * Returns the number of destination elements that source_size elements are
+ * scaled to, with the specified step, sampling the nearest source element.
+ */
+static uint16_t scaled_size(unsigned int source_size, uint32_t step);
+
+/*
+ * Blends two 0x00RRGGBB colors. weight goes from 0, which returns the destination
+ * color, to OPAQUE_WEIGHT, which returns the source color. Red and blue are blended
+ * together, because their products with the weight don't overlap in 32 bits.
+ */
+static uint32_t blend(uint32_t destination, uint32_t source, unsigned int weight);
+
+/*
+ * Blends a color over count pixels of the line buffer, starting at pixels.
+ */
+static void blend_run(uint32_t* pixels, unsigned int count, uint32_t color, unsigned int weight);
+
+/*
+ * Blends the part of a layer that lies on scanline y, between the columns start
+ * (inclusive) and end (exclusive), over the line buffer. Fill layers are the same
+ * on every scanline.
+ */
+static void compose_fill_row(const struct Layer* layer, unsigned int start, unsigned int end, unsigned int weight);
+static void compose_text_row(const struct Layer* layer, unsigned int y, unsigned int start, unsigned int end, unsigned int weight);
+
+/*
+ * Where an image layer is sampled on a scanline, and with which colors.
+ */
+struct ImageRow {
+    const uint8_t* raster_row;
+    // Source column of each pixel
+    const uint16_t* columns;
+    // Column of the first pixel from the left edge of the layer, which is shifted
+    // right to get its source column when the scale factor repeats every pixel
+    unsigned int column;
+    uint8_t column_shift;
+    // Low and high palette colors, as 0x00RRGGBB
+    uint32_t colors[2];
+};
+
+/*
+ * Template of the image row kernels, which is inlined with constant arguments, so
+ * the checks that depend on them are resolved at compile time. Blends count pixels
+ * of an image row over the line buffer, starting at pixels. skipped_color works
+ * like in struct ImageKernel. If blended is false, weight is ignored and pixels are
+ * copied as if they were opaque. If repeated is true, source columns are computed
+ * with a shift instead of being read from the column table.
+ */
+static inline __attribute__((always_inline)) void image_row_kernel(
+    const struct ImageRow* row, uint32_t* pixels, unsigned int count, unsigned int weight,
+    int8_t skipped_color, bool blended, bool repeated
+);
+
+/*
+ * Opaque kernels of every transparency mode, for any scale factor and for the ones
+ * that repeat every pixel.
+ */
+static void copy_opaque_image_row(const struct ImageRow* row, uint32_t* pixels, unsigned int count);
+static void copy_low_transparent_image_row(const struct ImageRow* row, uint32_t* pixels, unsigned int count);
+static void copy_high_transparent_image_row(const struct ImageRow* row, uint32_t* pixels, unsigned int count);
+static void copy_opaque_repeated_image_row(const struct ImageRow* row, uint32_t* pixels, unsigned int count);
+static void copy_low_transparent_repeated_image_row(const struct ImageRow* row, uint32_t* pixels, unsigned int count);
+static void copy_high_transparent_repeated_image_row(const struct ImageRow* row, uint32_t* pixels, unsigned int count);
+
+/*
+ * Chooses the kernel that copies the opaque rows of an image layer, from its
+ * transparency mode and horizontal scale factor.
+ */
+static void select_image_kernel(struct Layer* layer);
+
+/*
+ * Blends the part of an image layer that lies on scanline y, between the columns
+ * start (inclusive) and end (exclusive), over the line buffer. Translucent layers,
+ * which only happen during fades, share a generic kernel.
+ */
+static void compose_image_row(const struct Layer* layer, unsigned int y, unsigned int start, unsigned int end, unsigned int weight);
+
+/*
+ * Blends the part of a layer that lies on scanline y, between the columns start
+ * (inclusive) and end (exclusive), over the line buffer, with the composer of its
+ * kind. Layers with a clip region are only blended inside its spans.
+ */
+static void compose_layer_row(const struct Layer* layer, unsigned int y, unsigned int start, unsigned int end, unsigned int weight);
+static void compose_clipped_row(const struct Layer* layer, unsigned int y, unsigned int start, unsigned int end, unsigned int weight);
+
+/*
+ * Returns a value that is the same on two scanlines only if a layer draws the same
+ * on both: whether it covers them, which source row it samples, and which band of
+ * its clip region it is drawn in.
+ */
+static uint32_t layer_row_key(const struct Layer* layer, unsigned int y);
+
+/*
+ * Returns whether every layer that overlaps count pixels of scanline y, starting at
+ * column x, draws the same on them as on scanline y - 1.
+ */
+static bool span_repeats(unsigned int x, unsigned int y, unsigned int count);
+
+/*
+ * Composes count pixels of scanline y, starting at column x, and writes them to the
+ * screen. If repeated is true, the line buffer holds these pixels of scanline y - 1,
+ * and they are written again as they are if span_repeats says so.
+ */
+static void compose_span(unsigned int x, unsigned int y, unsigned int count, bool repeated);
+
+void mark_dirty(const struct Rect* rect) {
+    if (rect->width == 0 || rect->height == 0) {
+        return;
+    }
+
+    for (uint16_t i = 0; i < dirty_rect_count; ++i) {
+        struct Rect common = *rect;
+        intersect_rect(&common, &dirty_rects[i]);
+
+        if (common.width == rect->width && common.height == rect->height) {
+            return;
+        }
+    }
+
+    if (dirty_rect_count < REGION_MAX_RECTS) {
+        dirty_rects[dirty_rect_count++] = *rect;
+        return;
+    }
+
+    struct Rect* last = &dirty_rects[REGION_MAX_RECTS - 1];
+    uint16_t right = last->x + last->width > rect->x + rect->width ? last->x + last->width : rect->x + rect->width;
+    uint16_t bottom = last->y + last->height > rect->y + rect->height ? last->y + last->height : rect->y + rect->height;
+
+    if (rect->x < last->x) {
+        last->x = rect->x;
+    }
+
+    if (rect->y < last->y) {
+        last->y = rect->y;
+    }
+
+    last->width = right - last->x;
+    last->height = bottom - last->y;
+}
+
+void mark_layer_dirty(const struct Layer* layer) {
+    const struct Region* clip = layer->clip;
+    const struct Rect* bounds = &layer->bounds;
+
+    if (clip == NULL) {
+        mark_dirty(bounds);
+        return;
+    }
+
+    for (uint16_t i = 0; i < clip->rect_count; ++i) {
+        struct Rect rect = clip->rects[i];
+        intersect_rect(&rect, bounds);
+        mark_dirty(&rect);
+    }
+}
+
+uint32_t scale_step(uint16_t scale) {
+    return (SCALE_ONE << 16) / scale;
+}
+
+uint16_t scaled_size(unsigned int source_size, uint32_t step) {
+    return ((source_size << 16) + step - 1) / step;
+}
+
+void compute_bounds(struct Layer* layer) {
+    uint32_t width = layer->width;
+    uint32_t height = layer->height;
+    uint32_t step = 0;
+
+    if (layer->kind == LAYER_IMAGE) {
+        step = scale_step(layer->x_scale);
+        width = scaled_size(layer->image->width, step);
+        height = scaled_size(layer->image->height, scale_step(layer->y_scale));
+    } else if (layer->kind == LAYER_TEXT) {
+        width = (text_width(layer->font, layer->text) * layer->x_scale + SCALE_ONE - 1) >> 8;
+        height = scaled_size(layer->font->height, scale_step(layer->y_scale));
+    }
+
+    struct Rect screen = { 0, 0, modeInfoBlockPtr->XResolution, modeInfoBlockPtr->YResolution };
+
+    layer->bounds.x = layer->x;
+    layer->bounds.y = layer->y;
+    layer->bounds.width = width;
+    layer->bounds.height = height;
+    intersect_rect(&layer->bounds, &screen);
+
+    // Image rows are sampled at the same columns on every scanline
+    if (layer->kind == LAYER_IMAGE) {
+        uint32_t position = 0;
+
+        for (uint16_t i = 0; i < layer->bounds.width; ++i) {
+            layer->columns[i] = position >> 16;
+            position += step;
+        }
+    }
+}
+
+void add_layer(struct Layer* layer) {
+    if (layer_count == COMPOSITOR_MAX_LAYERS) {
+        return;
+    }
+
+    uint8_t i = layer_count++;
+    while (i > 0 && layers[i - 1]->z > layer->z) {
+        layers[i] = layers[i - 1];
+        --i;
+    }
+
+    layers[i] = layer;
+    layer->columns = column_tables + (layer_count - 1) * COLUMN_TABLE_SIZE;
+
+    // Rows are drawn through the mode without checking it every time
+    if (layer->transparency == NULL) {
+        layer->transparency = LAYER_OPAQUE;
+    }
+
+    select_image_kernel(layer);
+    compute_bounds(layer);
+    mark_layer_dirty(layer);
+}
+
+void update_layer(struct Layer* layer) {
+    mark_layer_dirty(layer);
+    select_image_kernel(layer);
+    compute_bounds(layer);
+    mark_layer_dirty(layer);
+}
+
+void select_image_kernel(struct Layer* layer) {
+    // The shift of the scale factors 1, 2 and 4, which any other one doesn't match
+    unsigned int shift = layer->x_scale / (2 * SCALE_ONE);
+
+    layer->column_shift = shift;
+    layer->copy_row = layer->x_scale == SCALE_ONE << shift ?
+        layer->transparency->copy_repeated_row : layer->transparency->copy_row;
+}
+
+uint32_t blend(uint32_t destination, uint32_t source, unsigned int weight) {
+    uint32_t red_blue = ((source & 0xFF00FF) * weight + (destination & 0xFF00FF) * (OPAQUE_WEIGHT - weight)) >> 8;
+    uint32_t green = ((source & 0x00FF00) * weight + (destination & 0x00FF00) * (OPAQUE_WEIGHT - weight)) >> 8;
+
+    return (red_blue & 0xFF00FF) | (green & 0x00FF00);
+}
+
+void blend_run(uint32_t* pixels, unsigned int count, uint32_t color, unsigned int weight) {
+    if (weight == OPAQUE_WEIGHT) {
+        for (unsigned int i = 0; i < count; ++i) {
+            pixels[i] = color;
+        }
+    } else {
+        for (unsigned int i = 0; i < count; ++i) {
+            pixels[i] = blend(pixels[i], color, weight);
+        }
+    }
+}
+
+void compose_fill_row(const struct Layer* layer, unsigned int start, unsigned int end, unsigned int weight) {
+    blend_run(
+        line + start, end - start,
+        (uint32_t) layer->color.r << 16 | layer->color.g << 8 | layer->color.b, weight
+    );
+}
+
+void image_row_kernel(
+    const struct ImageRow* row, uint32_t* pixels, unsigned int count, unsigned int weight,
+    int8_t skipped_color, bool blended, bool repeated
+) {
+    // Copied, so they are not read again after every pixel written
+    const uint8_t* raster_row = row->raster_row;
+    const uint16_t* columns = row->columns;
+    unsigned int column = row->column;
+    uint8_t column_shift = row->column_shift;
+    uint32_t colors[2] = { row->colors[0], row->colors[1] };
+
+    for (unsigned int i = 0; i < count; ++i) {
+        unsigned int source_x = repeated ? (column + i) >> column_shift : columns[i];
+        uint8_t color = (raster_row[source_x / 8] >> (7 - source_x % 8)) & 1;
+
+        if (color == skipped_color) {
+            continue;
+        }
+
+        pixels[i] = blended ? blend(pixels[i], colors[color], weight) : colors[color];
+    }
+}
+
+void copy_opaque_image_row(const struct ImageRow* row, uint32_t* pixels, unsigned int count) {
+    image_row_kernel(row, pixels, count, OPAQUE_WEIGHT, -1, false, false);
+}
+
+void copy_low_transparent_image_row(const struct ImageRow* row, uint32_t* pixels, unsigned int count) {
+    image_row_kernel(row, pixels, count, OPAQUE_WEIGHT, 0, false, false);
+}
+
+void copy_high_transparent_image_row(const struct ImageRow* row, uint32_t* pixels, unsigned int count) {
+    image_row_kernel(row, pixels, count, OPAQUE_WEIGHT, 1, false, false);
+}
+
+void copy_opaque_repeated_image_row(const struct ImageRow* row, uint32_t* pixels, unsigned int count) {
+    image_row_kernel(row, pixels, count, OPAQUE_WEIGHT, -1, false, true);
+}
+
+void copy_low_transparent_repeated_image_row(const struct ImageRow* row, uint32_t* pixels, unsigned int count) {
+    image_row_kernel(row, pixels, count, OPAQUE_WEIGHT, 0, false, true);
+}
+
+void copy_high_transparent_repeated_image_row(const struct ImageRow* row, uint32_t* pixels, unsigned int count) {
+    image_row_kernel(row, pixels, count, OPAQUE_WEIGHT, 1, false, true);
+}
+
+const struct ImageKernel opaque_image_kernel = {
+    copy_opaque_image_row, copy_opaque_repeated_image_row, -1
+};
+const struct ImageKernel low_transparent_image_kernel = {
+    copy_low_transparent_image_row, copy_low_transparent_repeated_image_row, 0
+};
+const struct ImageKernel high_transparent_image_kernel = {
+    copy_high_transparent_image_row, copy_high_transparent_repeated_image_row, 1
+};
+
+void compose_image_row(const struct Layer* layer, unsigned int y, unsigned int start, unsigned int end, unsigned int weight) {
+    const struct PbmImage* image = layer->image;
+    const struct PbmPalette* palette = image->palette;
+    uint16_t source_y = ((y - layer->y) * scale_step(layer->y_scale)) >> 16;
+    struct ImageRow row;
+
+    row.raster_row = (const uint8_t*) image->raster_pos + source_y * image->row_bytes;
+    row.column = start - layer->x;
+    row.columns = layer->columns + row.column;
+    row.column_shift = layer->column_shift;
+    row.colors[0] = (uint32_t) palette->low_r << 16 | palette->low_g << 8 | palette->low_b;
+    row.colors[1] = (uint32_t) palette->high_r << 16 | palette->high_g << 8 | palette->high_b;
+
+    if (weight == OPAQUE_WEIGHT) {
+        layer->copy_row(&row, line + start, end - start);
+    } else {
+        image_row_kernel(&row, line + start, end - start, weight, layer->transparency->skipped_color, true, false);
+    }
+}
+
+void compose_text_row(const struct Layer* layer, unsigned int y, unsigned int start, unsigned int end, unsigned int weight) {
+    const struct Font* font = layer->font;
+    uint32_t color = (uint32_t) layer->color.r << 16 | layer->color.g << 8 | layer->color.b;
+    uint16_t source_y = ((y - layer->y) * scale_step(layer->y_scale)) >> 16;
+    // Horizontal position of the current glyph in the string, at 1:1 scale
+    unsigned int pen = 0;
+
+    for (const char* c = layer->text; *c != '\0'; ++c) {
+        const struct Glyph* glyph = find_glyph(font, *c);
+
+        if (glyph == NULL) {
+            pen += font->height / 2;
+            continue;
+        }
+
+        // Rows that repeat the previous one are not in the bitmap
+        const uint8_t* bitmap = glyph->rows + (font->height + 7) / 8;
+        size_t bit = 0;
+        for (uint16_t j = 1; j <= source_y; ++j) {
+            if (((glyph->rows[j / 8] << (j % 8)) & 0x80) == 0) {
+                bit += glyph->width;
+            }
+        }
+
+        // Every run of ink of the row is blended at once
+        unsigned int run_x = 0;
+        for (unsigned int x = 0; x <= glyph->width; ++x, ++bit) {
+            if (x < glyph->width && ((bitmap[bit / 8] << (bit % 8)) & 0x80) != 0) {
+                continue;
+            }
+
+            // Same rounding as the scene layout, so runs of adjacent glyphs don't overlap
+            unsigned int span_start = layer->x + (((pen + run_x) * layer->x_scale + SCALE_ONE - 1) >> 8);
+            unsigned int span_end = layer->x + (((pen + x) * layer->x_scale + SCALE_ONE - 1) >> 8);
+            run_x = x + 1;
+
+            if (span_start < start) {
+                span_start = start;
+            }
+
+            if (span_end > end) {
+                span_end = end;
+            }
+
+            if (span_start < span_end) {
+                blend_run(line + span_start, span_end - span_start, color, weight);
+            }
+        }
+
+        pen += glyph->advance;
+    }
+}
+
+void compose_layer_row(const struct Layer* layer, unsigned int y, unsigned int start, unsigned int end, unsigned int weight) {
+    if (layer->kind == LAYER_FILL) {
+        compose_fill_row(layer, start, end, weight);
+    } else if (layer->kind == LAYER_IMAGE) {
+        compose_image_row(layer, y, start, end, weight);
+    } else {
+        compose_text_row(layer, y, start, end, weight);
+    }
+}
+
+void compose_clipped_row(const struct Layer* layer, unsigned int y, unsigned int start, unsigned int end, unsigned int weight) {
+    const struct Region* clip = layer->clip;
+
+    for (uint16_t i = 0; i < clip->band_count; ++i) {
+        const struct RegionBand* band = &clip->bands[i];
+
+        if (y < band->y || y >= band->y + band->height) {
+            continue;
+        }
+
+        for (uint16_t k = 0; k < band->span_count; ++k) {
+            const struct RegionSpan* span = &clip->spans[band->first_span + k];
+            unsigned int span_start = span->x > start ? span->x : start;
+            unsigned int span_end = span->x + span->width < end ? span->x + span->width : end;
+
+            if (span_start < span_end) {
+                compose_layer_row(layer, y, span_start, span_end, weight);
+            }
+        }
+    }
+}
+
+uint32_t layer_row_key(const struct Layer* layer, unsigned int y) {
+    const struct Rect* bounds = &layer->bounds;
+    const struct Region* clip = layer->clip;
+    uint32_t key = 0;
+
+    if (y < bounds->y || y >= bounds->y + bounds->height) {
+        return UINT32_MAX;
+    }
+
+    if (layer->kind != LAYER_FILL) {
+        key = (uint16_t) (((y - layer->y) * scale_step(layer->y_scale)) >> 16);
+    }
+
+    if (clip != NULL) {
+        uint16_t i = 0;
+
+        while (i < clip->band_count && (y < clip->bands[i].y || y >= clip->bands[i].y + clip->bands[i].height)) {
+            ++i;
+        }
+
+        key |= (uint32_t) i << 16;
+    }
+
+    return key;
+}
+
+bool span_repeats(unsigned int x, unsigned int y, unsigned int count) {
+    for (uint8_t i = 0; i < layer_count; ++i) {
+        const struct Layer* layer = layers[i];
+        const struct Rect* bounds = &layer->bounds;
+
+        if (layer->alpha != 0 && bounds->x < x + count && bounds->x + bounds->width > x &&
+            layer_row_key(layer, y) != layer_row_key(layer, y - 1)) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+void compose_span(unsigned int x, unsigned int y, unsigned int count, bool repeated) {
+    uint8_t* ccPtr = modeInfoBlockPtr->PhysBasePtr + y * modeInfoBlockPtr->BytesPerScanLine + x * 3;
+
+    // Scanlines that scaled layers repeat are composed once
+    if (!repeated || !span_repeats(x, y, count)) {
+        blend_run(line + x, count, 0, OPAQUE_WEIGHT);
+
+        for (uint8_t i = 0; i < layer_count; ++i) {
+            const struct Layer* layer = layers[i];
+            const struct Rect* bounds = &layer->bounds;
+            unsigned int start = x > bounds->x ? x : bounds->x;
+            unsigned int end = x + count < bounds->x + bounds->width ? x + count : bounds->x + bounds->width;
+            // Alpha 255 is fully opaque, so it weighs OPAQUE_WEIGHT
+            unsigned int weight = layer->alpha + (layer->alpha >> 7);
+
+            if (weight == 0 || y < bounds->y || y >= bounds->y + bounds->height || start >= end) {
+                continue;
+            }
+
+            if (layer->clip != NULL) {
+                compose_clipped_row(layer, y, start, end, weight);
+            } else {
+                compose_layer_row(layer, y, start, end, weight);
+            }
+        }
+    }
+
+    for (uint16_t i = x; i < x + count; ++i) {
+        // Little endian order, so MSB goes last
+        *ccPtr++ = line[i];
+        *ccPtr++ = line[i] >> 8;
+        *ccPtr++ = line[i] >> 16;
+    }
+}
+
+void compose(void) {
+    // Overlapping dirty rectangles are normalized into spans, so no pixel is composed twice
+    set_region_rects(&dirty_region, dirty_rects, dirty_rect_count);
+    dirty_rect_count = 0;
+
+    for (uint16_t i = 0; i < dirty_region.band_count; ++i) {
+        const struct RegionBand* band = &dirty_region.bands[i];
+        const struct RegionSpan* spans = &dirty_region.spans[band->first_span];
+
+        for (uint16_t y = band->y; y < band->y + band->height; ++y) {
+            for (uint16_t k = 0; k < band->span_count; ++k) {
+                compose_span(spans[k].x, y, spans[k].width, y > band->y);
+            }
+        }
+    }
+}
@@ -0,0 +1,115 @@
+#pragma once
+
+#include <stdint.h>
+#include "drawing.h"
+#include "pbm_decoder.h"
+
+// Maximum number of layers the compositor can stack
+#define COMPOSITOR_MAX_LAYERS 8
+
+/*
+ * What a layer draws.
+ */
+enum LayerKind {
+    // A rectangle of a solid color
+    LAYER_FILL,
+    // A PBM image, with the colors of its palette
+    LAYER_IMAGE,
+    // A string of a font, with a solid color
+    LAYER_TEXT
+};
+
+struct ImageRow;
+
+/*
+ * How an image layer is drawn, depending on which of its pixels are drawn. Each mode
+ * has its own kernels for opaque rows, with the pixel selection fixed at compile time,
+ * and the modes that no layer refers to are left out of the payload by the linker.
+ */
+struct ImageKernel {
+    // Copies count pixels of an image row to the line buffer of the compositor, with
+    // any horizontal scale factor
+    void (*copy_row)(const struct ImageRow* row, uint32_t* pixels, unsigned int count);
+    // Same, for horizontal scale factors that repeat every pixel 1, 2 or 4 times
+    void (*copy_repeated_row)(const struct ImageRow* row, uint32_t* pixels, unsigned int count);
+    // Palette index (0 for low, 1 for high) of the pixels that are not drawn, or -1
+    int8_t skipped_color;
+};
+
+extern const struct ImageKernel opaque_image_kernel;
+extern const struct ImageKernel low_transparent_image_kernel;
+extern const struct ImageKernel high_transparent_image_kernel;
+
+/*
+ * Which pixels of an image layer are drawn.
+ */
+// Every pixel
+#define LAYER_OPAQUE (&opaque_image_kernel)
+// Pixels of the low palette color are not drawn, so layers below show through
+#define LAYER_LOW_TRANSPARENT (&low_transparent_image_kernel)
+// Pixels of the high palette color are not drawn
+#define LAYER_HIGH_TRANSPARENT (&high_transparent_image_kernel)
+
+/*
+ * Something drawn on the screen by the compositor, blended with the layers below
+ * it. The fields that don't apply to the layer kind are ignored.
+ */
+struct Layer {
+    enum LayerKind kind;
+    // Layers with a higher z are drawn over the ones with a lower z
+    uint8_t z;
+    // Opacity, from 0 (invisible) to 255 (opaque)
+    uint8_t alpha;
+    // Left-upper vertex of the layer on the screen
+    uint16_t x;
+    uint16_t y;
+    // Size of fill layers. Image and text layers take the size of their contents
+    uint16_t width;
+    uint16_t height;
+    // Scale factors of image and text layers (see SCALE_ONE). Pixels are sampled
+    // from the nearest source pixel, so integer scales repeat every pixel that many times
+    uint16_t x_scale;
+    uint16_t y_scale;
+    // Color of fill and text layers
+    struct Pixel color;
+    struct PbmImage* image;
+    // One of the LAYER_*_TRANSPARENT or LAYER_OPAQUE modes. NULL means LAYER_OPAQUE
+    const struct ImageKernel* transparency;
+    const struct Font* font;
+    const char* text;
+    // If not NULL, the layer is only drawn inside this region, which must not
+    // change while the layer is in the compositor
+    const struct Region* clip;
+    // Screen rectangle the layer covers, computed by the compositor
+    struct Rect bounds;
+    // Source column of every screen column an image layer covers, from its left
+    // edge, computed by the compositor
+    uint16_t* columns;
+    // Kernel of the transparency mode that copies opaque rows, chosen by the compositor
+    // for the horizontal scale factor, and how many bits its columns are shifted right
+    void (*copy_row)(const struct ImageRow* row, uint32_t* pixels, unsigned int count);
+    uint8_t column_shift;
+};
+
+/*
+ * Adds a layer to the compositor, below any layer with a higher z and above the
+ * rest. The layer must stay valid as long as the compositor runs. Layers can't be
+ * removed, but a layer with zero alpha is not drawn. At most COMPOSITOR_MAX_LAYERS
+ * layers are taken into account.
+ */
+void add_layer(struct Layer* layer);
+
+/*
+ * Tells the compositor that some field of a layer was changed, so the part of the
+ * screen it covered before and the part it covers now are drawn again by compose.
+ */
+void update_layer(struct Layer* layer);
+
+/*
+ * Draws the parts of the screen that the layers added or updated since the last
+ * call cover. Pixels not covered by any layer are black. Every pixel is computed
+ * once, from the bottom layer to the top one, in a line buffer, so the screen is
+ * written once per pixel and never read. Scanlines that every layer draws the same
+ * as the one above, like the ones a vertical scale repeats, are not composed again.
+ */
+void compose(void);
@@ -1,33 +1,25 @@
 #include "drawing.h"
+#include "baselib.h"
 #include "vbe.h"
 
 static struct Pixel constant_pixel;
-static struct PbmImage* current_image;
-static uint8_t current_x_scale;
 
 static struct Pixel* constant_pixel_producer(void);
-static struct Pixel* image_pixel_producer(void);
 
 static void internal_fill(uint16_t x, uint16_t y, uint16_t width, uint16_t height, struct Pixel*(*pixel_producer)(void));
 
-struct Pixel* constant_pixel_producer(void) {
-    return &constant_pixel;
-}
+/*
+ * Inserts an edge coordinate in a sorted array of them, unless it is already there.
+ */
+static void insert_edge(uint16_t* edges, unsigned int* edge_count, uint16_t edge);
 
-struct Pixel* image_pixel_producer(void) {
-    static uint8_t i = 0;
-    static struct Pixel* current_pixel = NULL;
+/*
+ * Computes the bands and spans of a region from its rectangles.
+ */
+static void build_region(struct Region* region);
 
-    if (i == 0 || i >= current_x_scale) {
-        current_pixel = next_pixel(current_image);
-    }
-
-    if (i >= current_x_scale) {
-        i = 0;
-    }
-
-    ++i;
-    return current_pixel;
+struct Pixel* constant_pixel_producer(void) {
+    return &constant_pixel;
 }
 
 static void internal_fill(uint16_t x, uint16_t y, uint16_t width, uint16_t height, struct Pixel*(*pixel_producer)(void)) {
@@ -51,27 +43,212 @@ void fill(uint16_t x, uint16_t y, uint16_t width, uint16_t height, uint8_t r, ui
     internal_fill(x, y, width, height, &constant_pixel_producer);
 }
 
-void draw_pbm_image(struct PbmImage* image, uint16_t x, uint16_t y, uint8_t x_scale) {
-    current_image = image;
-    current_x_scale = x_scale;
-    internal_fill(x, y, image->width * x_scale, image->height, &image_pixel_producer);
+void intersect_rect(struct Rect* rect, const struct Rect* other) {
+    unsigned int left = rect->x > other->x ? rect->x : other->x;
+    unsigned int top = rect->y > other->y ? rect->y : other->y;
+    unsigned int right = rect->x + rect->width < other->x + other->width ?
+        rect->x + rect->width : other->x + other->width;
+    unsigned int bottom = rect->y + rect->height < other->y + other->height ?
+        rect->y + rect->height : other->y + other->height;
+
+    rect->x = left;
+    rect->y = top;
+    rect->width = 0;
+    rect->height = 0;
+
+    if (left < right && top < bottom) {
+        rect->width = right - left;
+        rect->height = bottom - top;
+    }
 }
 
-void replace_color(
-    uint8_t r, uint8_t g, uint8_t b, uint8_t new_r, uint8_t new_g, uint8_t new_b,
-    uint16_t x, uint16_t y, uint16_t width, uint16_t height
-) {
-    for (uint16_t j = y; j < modeInfoBlockPtr->YResolution && j < y + height; ++j) {
-        uint8_t* ccPtr = modeInfoBlockPtr->PhysBasePtr + j * modeInfoBlockPtr->BytesPerScanLine + x * 3;
+void insert_edge(uint16_t* edges, unsigned int* edge_count, uint16_t edge) {
+    unsigned int i = *edge_count;
 
-        for (uint16_t i = x; i < modeInfoBlockPtr->XResolution && i < x + width; ++i) {
-            if (*ccPtr == b && *(ccPtr + 1) == g && *(ccPtr + 2) == r) {
-                *ccPtr = new_b;
-                *(ccPtr + 1) = new_g;
-                *(ccPtr + 2) = new_r;
+    while (i > 0 && edges[i - 1] > edge) {
+        --i;
+    }
+
+    if (i > 0 && edges[i - 1] == edge) {
+        return;
+    }
+
+    for (unsigned int j = *edge_count; j > i; --j) {
+        edges[j] = edges[j - 1];
+    }
+
+    edges[i] = edge;
+    ++*edge_count;
+}
+
+void build_region(struct Region* region) {
+    uint16_t edges[REGION_MAX_BANDS];
+    unsigned int edge_count = 0;
+    unsigned int span_count = 0;
+
+    region->band_count = 0;
+
+    // Every horizontal edge may start a band with different spans
+    for (unsigned int i = 0; i < region->rect_count; ++i) {
+        const struct Rect* rect = &region->rects[i];
+
+        if (rect->width > 0 && rect->height > 0) {
+            insert_edge(edges, &edge_count, rect->y);
+            insert_edge(edges, &edge_count, rect->y + rect->height);
+        }
+    }
+
+    for (unsigned int e = 0; e + 1 < edge_count; ++e) {
+        uint16_t y = edges[e];
+        struct RegionSpan* spans = &region->spans[span_count];
+        unsigned int count = 0;
+
+        // Insert the rectangles that cross the band, sorted left to right
+        for (unsigned int i = 0; i < region->rect_count; ++i) {
+            const struct Rect* rect = &region->rects[i];
+
+            if (rect->width == 0 || y < rect->y || y >= rect->y + rect->height) {
+                continue;
+            }
+
+            unsigned int k = count++;
+            while (k > 0 && spans[k - 1].x > rect->x) {
+                spans[k] = spans[k - 1];
+                --k;
+            }
+
+            spans[k].x = rect->x;
+            spans[k].width = rect->width;
+        }
+
+        // Merge the spans that overlap or touch each other
+        unsigned int merged = 0;
+        for (unsigned int k = 0; k < count; ++k) {
+            struct RegionSpan* last = merged > 0 ? &spans[merged - 1] : NULL;
+
+            if (last != NULL && spans[k].x <= last->x + last->width) {
+                if (spans[k].x + spans[k].width > last->x + last->width) {
+                    last->width = spans[k].x + spans[k].width - last->x;
+                }
+            } else {
+                spans[merged++] = spans[k];
+            }
+        }
+
+        if (merged == 0) {
+            continue;
+        }
+
+        // Grow the band right above instead, if it has the same spans
+        struct RegionBand* band = region->band_count > 0 ? &region->bands[region->band_count - 1] : NULL;
+        bool same_spans = band != NULL && band->y + band->height == y && band->span_count == merged;
+
+        for (unsigned int k = 0; same_spans && k < merged; ++k) {
+            struct RegionSpan* span = &region->spans[band->first_span + k];
+            same_spans = span->x == spans[k].x && span->width == spans[k].width;
+        }
+
+        if (same_spans) {
+            band->height += edges[e + 1] - y;
+        } else {
+            band = &region->bands[region->band_count++];
+            band->y = y;
+            band->height = edges[e + 1] - y;
+            band->first_span = span_count;
+            band->span_count = merged;
+            span_count += merged;
+        }
+    }
+}
+
+void set_region_rects(struct Region* region, const struct Rect* rects, uint16_t rect_count) {
+    struct Rect screen = { 0, 0, modeInfoBlockPtr->XResolution, modeInfoBlockPtr->YResolution };
+    bool changed = false;
+
+    if (rect_count > REGION_MAX_RECTS) {
+        rect_count = REGION_MAX_RECTS;
+    }
+
+    for (uint16_t i = 0; i < rect_count; ++i) {
+        struct Rect rect = rects[i];
+
+        // Clip to the screen, so spans can be walked without any further checks
+        intersect_rect(&rect, &screen);
+
+        struct Rect* previous = &region->rects[i];
+        if (previous->x != rect.x || previous->y != rect.y ||
+            previous->width != rect.width || previous->height != rect.height) {
+            *previous = rect;
+            changed = true;
+        }
+    }
+
+    if (changed || rect_count != region->rect_count) {
+        region->rect_count = rect_count;
+        build_region(region);
+    }
+}
+
+bool load_font(struct Font* font, const uint8_t* data, size_t size) {
+    if (size < 2 || data[1] > FONT_MAX_GLYPHS) {
+        return false;
+    }
+
+    font->height = data[0];
+    font->glyph_count = data[1];
+
+    size_t position = 2 + font->glyph_count * 3;
+    // One bit per row, telling whether it repeats the previous row
+    size_t repeat_mask_size = (font->height + 7) / 8;
+
+    for (uint8_t i = 0; i < font->glyph_count; ++i) {
+        struct Glyph* glyph = &font->glyphs[i];
+        size_t bits = 0;
+
+        if (position + repeat_mask_size > size) {
+            return false;
+        }
+
+        glyph->character = data[2 + i * 3];
+        glyph->width = data[3 + i * 3];
+        glyph->advance = data[4 + i * 3];
+        glyph->rows = data + position;
+
+        for (uint8_t y = 0; y < font->height; ++y) {
+            if (y == 0 || ((glyph->rows[y / 8] << (y % 8)) & 0x80) == 0) {
+                bits += glyph->width;
             }
+        }
+
+        position += repeat_mask_size + (bits + 7) / 8;
+    }
 
-            ccPtr += 3;
+    return position <= size;
+}
+
+const struct Glyph* find_glyph(const struct Font* font, uint8_t character) {
+    for (uint8_t i = 0; i < font->glyph_count; ++i) {
+        if (font->glyphs[i].character == character) {
+            return &font->glyphs[i];
+        }
+    }
+
+    return NULL;
+}
+
+uint16_t text_width(const struct Font* font, const char* text) {
+    uint16_t width = 0;
+
+    for (const char* c = text; *c != '\0'; ++c) {
+        const struct Glyph* glyph = find_glyph(font, *c);
+
+        if (glyph == NULL) {
+            width += font->height / 2;
+        } else {
+            // The last glyph ends at its ink, not where the next one would start
+            width += c[1] != '\0' ? glyph->advance : glyph->width;
         }
     }
+
+    return width;
 }
@@ -1,25 +1,124 @@
 #pragma once
 
+#include <stddef.h>
 #include <stdint.h>
+#include <stdbool.h>
 #include "pbm_decoder.h"
 
+/*
+ * Scale factors are fixed point numbers with 8 fractional bits, so SCALE_ONE
+ * means 1:1 scale, SCALE_ONE * 2 doubles the size and SCALE_ONE * 3 / 2 stretches
+ * to 150%.
+ */
+#define SCALE_ONE 256
+
 /*
  * Fills a rectangle with the specified color, whose left-upper vertex is at (x, y).
  */
 void fill(uint16_t x, uint16_t y, uint16_t width, uint16_t height, uint8_t r, uint8_t g, uint8_t b);
 
+// Maximum number of rectangles a region can be made of
+#define REGION_MAX_RECTS 8
+// Scanlines are grouped in bands that cross the same rectangles, so there
+// is at most a band between each pair of consecutive horizontal edges
+#define REGION_MAX_BANDS (REGION_MAX_RECTS * 2)
+#define REGION_MAX_SPANS (REGION_MAX_BANDS * REGION_MAX_RECTS)
+
+/*
+ * A screen rectangle, whose left-upper vertex is at (x, y).
+ */
+struct Rect {
+    uint16_t x;
+    uint16_t y;
+    uint16_t width;
+    uint16_t height;
+};
+
+/*
+ * Reduces a rectangle to its intersection with another one. If they don't
+ * intersect, the result has zero width and height.
+ */
+void intersect_rect(struct Rect* rect, const struct Rect* other);
+
+/*
+ * A horizontal run of pixels of a region band.
+ */
+struct RegionSpan {
+    uint16_t x;
+    uint16_t width;
+};
+
+/*
+ * A group of consecutive scanlines of a region that cover the same spans.
+ */
+struct RegionBand {
+    uint16_t y;
+    uint16_t height;
+    uint16_t first_span;
+    uint16_t span_count;
+};
+
+/*
+ * The union of a list of rectangles, normalized into bands of non-overlapping
+ * spans, sorted top to bottom and left to right. Every pixel of the region
+ * belongs to exactly one span, even if several rectangles contain it.
+ */
+struct Region {
+    struct Rect rects[REGION_MAX_RECTS];
+    uint16_t rect_count;
+    uint16_t band_count;
+    struct RegionBand bands[REGION_MAX_BANDS];
+    struct RegionSpan spans[REGION_MAX_SPANS];
+};
+
+/*
+ * Sets the rectangles a region is made of, clipped to the screen. At most
+ * REGION_MAX_RECTS rectangles are taken into account. The bands and spans are
+ * only computed again if the rectangles differ from the previous ones, so
+ * this can be called every frame at a negligible cost.
+ */
+void set_region_rects(struct Region* region, const struct Rect* rects, uint16_t rect_count);
+
+// Maximum number of glyphs of a font. Must match the font compiler in util
+#define FONT_MAX_GLYPHS 32
+
+/*
+ * A glyph of a font, drawn straight from the font data. rows points to a bit per
+ * row, set if the row repeats the previous one, followed by the 1 bpp bitmap of the
+ * rest of rows, without padding between them.
+ */
+struct Glyph {
+    uint8_t character;
+    uint8_t width;
+    // Columns from the start of this glyph to the start of the next one in a string
+    uint8_t advance;
+    const uint8_t* rows;
+};
+
+/*
+ * A 1 bpp bitmap font generated by the font compiler in util. All glyphs are as
+ * tall as the font.
+ */
+struct Font {
+    uint8_t height;
+    uint8_t glyph_count;
+    struct Glyph glyphs[FONT_MAX_GLYPHS];
+};
+
+/*
+ * Loads a font from the data generated by the font compiler. The data must stay
+ * valid as long as the font is used. Returns false if the data is not valid or
+ * has more than FONT_MAX_GLYPHS glyphs.
+ */
+bool load_font(struct Font* font, const uint8_t* data, size_t size);
+
 /*
- * Draws the specified PBM image on the screen, starting at (x, y).
- * x_scale represents how many times a pixel will be repeated horizontally,
- * effectively stretching the image. It should be at least one.
+ * Returns the glyph of a character in a font, or NULL if it has none.
  */
-void draw_pbm_image(struct PbmImage* image, uint16_t x, uint16_t y, uint8_t x_scale);
+const struct Glyph* find_glyph(const struct Font* font, uint8_t character);
 
 /*
- * Replaces the specified color with another color, inside a rectangle
- * whose left-upper vertex is at (x, y).
+ * Returns the width of a string drawn in the specified font at 1:1 scale.
+ * Characters without a glyph advance half the font height.
  */
-void replace_color(
-    uint8_t r, uint8_t g, uint8_t b, uint8_t new_r, uint8_t new_g, uint8_t new_b,
-    uint16_t x, uint16_t y, uint16_t width, uint16_t height
-);
+uint16_t text_width(const struct Font* font, const char* text);
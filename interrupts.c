@@ -10,8 +10,6 @@
 #define MASTER_PIC_DATA 0x21
 #define SLAVE_PIC_COMMAND 0xA0
 #define SLAVE_PIC_DATA 0xA1
-#define PIT_COMMAND 0x43
-#define PIT_DATA 0x40
 
 #define ICW1_INIT 0x10
 #define ICW1_ICW4 0x01
@@ -22,18 +20,40 @@
 //static const uint32_t idt_size = sizeof(struct interrupt_descriptor) * idt_entries + sizeof(struct interrupt_descriptor_table);
 //static const uint32_t idt_start = 0x7FFFF - idt_size + 1;
 
-static const uint16_t idt_entries = 33; // 33 IRQ. 32 mandatory by Intel in protected mode for processor exceptions
-static const uint32_t idt_start = 0x7FEF0;
+// 32 mandatory by Intel in protected mode for processor exceptions, and 16 for hardware IRQ
+static const uint16_t idt_entries = 0x20 + IRQ_LINES;
+static const uint32_t idt_start = 0x7FE70;
 
 static bool interruptsConfigured = false;
 
-static void (*tickFunc)(void) = NULL;
+// Handlers for every IRQ line, called by the entry stubs in isr.asm.
+// IRQ 0 is handled by the tick function
+void (*irqHandlers[IRQ_LINES])(void) = { NULL };
+// Incremented by the IRQ 0 entry stub
+volatile uint32_t tickCount = 0;
 
-__attribute__((interrupt)) static void cpu_exception_isr(struct interrupt_frame*, unsigned int);
-__attribute__((interrupt)) static void pit_isr(struct interrupt_frame*);
+// Bit set for every IRQ line masked in the PICs. The master PIC uses the low byte
+static uint16_t irqMask = 0xFFFF;
+// Mask last sent to the PICs, so unchanged masks are not sent again. Initializing
+// the PICs clears their masks
+static uint16_t picMask;
+
+// Addresses of the entry stubs in isr.asm, for every IDT entry
+extern const uint32_t isr_stub_table[];
+
+/*
+ * Called by the exception entry stubs in isr.asm. Draws a color code that
+ * identifies the exception and never returns.
+ */
+void cpu_exception_handler(uint32_t vector, uint32_t error_code);
+
+/*
+ * Sends the current IRQ mask to the PICs, unless they already have it.
+ */
+static void update_irq_mask(void);
 
 void setup_interrupts(void (*tickFunction) (void)) {
-	tickFunc = tickFunction;
+	set_irq_handler(0, tickFunction);
 
 	if (!interruptsConfigured) {
 		struct interrupt_descriptor_table* idt = (struct interrupt_descriptor_table*) idt_start;
@@ -47,11 +67,11 @@ void setup_interrupts(void (*tickFunction) (void)) {
 
 		struct interrupt_descriptor* current_desc = first_desc;
 
-		// Populate the entries in the IDT.
-		// The first 32 descriptors handle CPU exceptions
-		for (unsigned int i = 0; i < 0x20; ++i) {
-			current_desc->offset_low = ((uint32_t) &cpu_exception_isr) & 0xFFFF;
-			current_desc->offset_high = (((uint32_t) &cpu_exception_isr) & 0xFFFF0000) >> 16;
+		// Populate the entries in the IDT. The first 32 descriptors handle
+		// CPU exceptions, and the rest handle IRQ, each one with its own stub
+		for (unsigned int i = 0; i < idt_entries; ++i) {
+			current_desc->offset_low = isr_stub_table[i] & 0xFFFF;
+			current_desc->offset_high = (isr_stub_table[i] & 0xFFFF0000) >> 16;
 			current_desc->segment_selector = 0x08; // The bootloader places us here
 			current_desc->zero = 0;
 			// 32-bit interrupt gate, present, privilege level 0, storage segment 0
@@ -59,14 +79,6 @@ void setup_interrupts(void (*tickFunction) (void)) {
 			++current_desc;
 		}
 
-		// The 33rd descriptor is somewhat special, because we want
-		// to handle PIT interrupts which go to it
-		current_desc->offset_low = ((uint32_t) &pit_isr) & 0xFFFF;
-		current_desc->offset_high = (((uint32_t) &pit_isr) & 0xFFFF0000) >> 16;
-		current_desc->segment_selector = 0x08;
-		current_desc->zero = 0;
-		current_desc->type_attributes = 0x8E;
-
 		// Load the IDT
 		__asm__ volatile("LIDT %0" : : "m"(*idt));
 
@@ -89,23 +101,20 @@ void setup_interrupts(void (*tickFunction) (void)) {
 		approximate_udelay(2);
 		outb(SLAVE_PIC_DATA, ICW4_8086);
 		approximate_udelay(2);
+		picMask = 0;
 
-		// Configure the master PIC with a mask of the interrupts we actually handle
-		// (only PIT for now, ignore slave)
-		outb(MASTER_PIC_DATA, 0xFE);
-		approximate_udelay(2);
+		// Configure the PICs with a mask of the interrupts we actually handle
+		update_irq_mask();
 
 		outb(PIT_COMMAND, 0x34); // LO/HI access mode, rate generator, channel 0
-		// We want to use a reload value of 419, so frequency is divided by 419.
-		// The resulting period is very close to 0.5 ms (499.943258 us), so for
+		// We want to use a reload value of 597, so frequency is divided by 597.
+		// The resulting period is very close to 0.5 ms (500.34 us), so for
 		// practical purposes we can tell a tick occurs each half of millisecond.
-		// We send the first low byte, 0xA3, and then the high byte, 0x01.
-		// After the high byte is sent, the PIT starts ticking.
-		// After one second, the clock would be off by 0.11 ms, which means that,
-		// after one hour, it would be off by 408.5 ms. Not great, but enough
-		// for our purposes
-		outb(PIT_DATA, 0xA3);
-		outb(PIT_DATA, 0x01);
+		// We send the first low byte, and then the high byte. After the high
+		// byte is sent, the PIT starts ticking. Ticks are not meant for precise
+		// time measurement, though: see clock.h for that
+		outb(PIT_DATA, PIT_RELOAD & 0xFF);
+		outb(PIT_DATA, PIT_RELOAD >> 8);
 
 		interruptsConfigured = true;
 
@@ -114,18 +123,44 @@ void setup_interrupts(void (*tickFunction) (void)) {
 	}
 }
 
-__attribute__((interrupt)) void cpu_exception_isr(
-	__attribute__ ((unused)) struct interrupt_frame* frame, unsigned int error_code
-) {
-	fill(0, 0, modeInfoBlockPtr->XResolution, modeInfoBlockPtr->YResolution, 255, 0, error_code);
-	halt(true);
+void set_irq_handler(uint8_t irq, void (*handler)(void)) {
+	irqHandlers[irq] = handler;
+
+	if (handler != NULL) {
+		irqMask &= ~(1 << irq);
+	} else {
+		irqMask |= 1 << irq;
+	}
+
+	update_irq_mask();
 }
 
-__attribute__((interrupt)) void pit_isr(__attribute__ ((unused)) struct interrupt_frame* frame) {
-	// Call the time tick function
-	if (tickFunc != NULL) {
-		(*tickFunc)();
+void update_irq_mask(void) {
+	// The slave PIC is cascaded through IRQ 2, so it must be unmasked
+	// whenever any slave line is
+	uint16_t mask = irqMask;
+	if ((mask & 0xFF00) != 0xFF00) {
+		mask &= ~(1 << 2);
 	}
+
+	if (mask == picMask) {
+		return;
+	}
+	picMask = mask;
+
+	outb(MASTER_PIC_DATA, mask & 0xFF);
+	approximate_udelay(2);
+	outb(SLAVE_PIC_DATA, mask >> 8);
+	approximate_udelay(2);
+}
+
+void cpu_exception_handler(uint32_t vector, uint32_t error_code) {
+	fill(0, 0, modeInfoBlockPtr->XResolution, modeInfoBlockPtr->YResolution, 255, vector, error_code);
+	halt(true);
+}
+
+uint32_t get_tick_count(void) {
+	return tickCount;
 }
 
 inline void sti(void) {
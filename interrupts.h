@@ -2,6 +2,15 @@
 
 #include <stdint.h>
 
+#define PIT_COMMAND 0x43
+#define PIT_DATA 0x40
+#define PIT_FREQUENCY 1193182 // Hz
+// Channel 0 reload value. 1193182 / 597 = 1998.63 Hz, so a tick happens every 500.34 us
+#define PIT_RELOAD 597
+
+// Number of hardware interrupt lines of the two cascaded PICs
+#define IRQ_LINES 16
+
 struct interrupt_descriptor {
 	uint16_t offset_low;		// 0-15
 	uint16_t segment_selector;	// Code descriptor in GDT
@@ -19,21 +28,27 @@ struct interrupt_descriptor_table {
 
 _Static_assert(sizeof(struct interrupt_descriptor_table) == 6, "The IDT must be 6 bytes long");
 
-struct interrupt_frame {
-    uint16_t ip;
-    uint16_t cs;
-    uint16_t flags;
-    uint16_t sp;
-    uint16_t ss;
-} __attribute__((packed));
-
 /**
  * Configures the Interrupt Descriptor Table and the Programmable Interrupt Controller
  * in order for the CPU to handle interrupts properly. Afterwards, it enables interrupts.
- * The specified tick function will be executed whenever 0.5 ms pass (actually, 499.943258 us).
+ * The specified tick function will be executed whenever 0.5 ms pass (actually, 500.34 us).
  */
 void setup_interrupts(void (*tickFunction) (void));
 
+/**
+ * Sets the function that will be executed when the specified hardware interrupt
+ * line (0 to 15) is raised, and unmasks that line in the PIC. A NULL handler masks
+ * the line again. Handlers run with interrupts disabled, and the PIC is configured
+ * with automatic end of interrupt, so they need not acknowledge it. IRQ 0 is used
+ * by the PIT, and its handler is the tick function.
+ */
+void set_irq_handler(uint8_t irq, void (*handler)(void));
+
+/**
+ * Returns the number of PIT ticks that happened since interrupts were configured.
+ */
+uint32_t get_tick_count(void);
+
 /**
  * Enables hardware and software interrupts. The IDT and PIC should be configured
  * previously.
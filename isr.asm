@@ -0,0 +1,111 @@
+; Intel 80386 compliance
+CPU 386
+BITS 32
+
+; Interrupt service routine entry stubs, one for every IDT entry, so
+; the vector number is known. They only save the registers that the
+; C calling convention does not preserve (EAX, ECX and EDX) before
+; calling C code. The PIC is configured with automatic end of
+; interrupt, so no acknowledgement is needed.
+
+GLOBAL isr_stub_table
+
+EXTERN cpu_exception_handler
+EXTERN irqHandlers
+EXTERN tickCount
+
+SECTION .text
+
+; --------------------
+; CPU exception stubs
+; --------------------
+
+; Exceptions 8, 10 to 14, 17, 21, 29 and 30 push an error code. For
+; the rest, a zero is pushed instead, so the stack layout is the same
+%assign vector 0
+%rep 32
+exception_stub_%[vector]:
+	%if !(vector = 8 || (vector >= 10 && vector <= 14) || vector = 17 || vector = 21 || vector = 29 || vector = 30)
+		PUSH 0
+	%endif
+	PUSH vector
+	JMP exception_common
+	%assign vector vector + 1
+%endrep
+
+; Calls cpu_exception_handler(vector, error code), which never returns.
+exception_common:
+	CLD
+	CALL cpu_exception_handler
+	JMP $
+
+; ---------
+; IRQ stubs
+; ---------
+
+; The PIT tick is the hottest path, so it gets a stub of its own that
+; does not share the common dispatch code.
+irq_stub_0:
+	INC dword [tickCount]
+
+	PUSH eax
+	PUSH ecx
+	PUSH edx
+	CLD
+
+	MOV eax, [irqHandlers]
+	TEST eax, eax
+	JZ .return
+	CALL eax
+
+	.return:
+		POP edx
+		POP ecx
+		POP eax
+		IRETD
+
+%assign irq 1
+%rep 15
+irq_stub_%[irq]:
+	PUSH eax
+	MOV eax, irq
+	JMP irq_common
+	%assign irq irq + 1
+%endrep
+
+; Calls the handler of the IRQ line in EAX, if any. The original
+; value of EAX was pushed by the stub.
+irq_common:
+	PUSH ecx
+	PUSH edx
+	CLD
+
+	MOV eax, [irqHandlers + eax * 4]
+	TEST eax, eax
+	JZ .return ; Spurious or not handled
+	CALL eax
+
+	.return:
+		POP edx
+		POP ecx
+		POP eax
+		IRETD
+
+; ---------
+; Constants
+; ---------
+
+SECTION .rodata
+
+; Entry stub addresses, in IDT order
+isr_stub_table:
+%assign vector 0
+%rep 32
+	DD exception_stub_%[vector]
+	%assign vector vector + 1
+%endrep
+%assign irq 0
+%rep 16
+	DD irq_stub_%[irq]
+	%assign irq irq + 1
+%endrep
@@ -0,0 +1,43 @@
+#pragma once
+
+#include <stdint.h>
+
+// Address range types reported by the BIOS
+#define MEMORY_MAP_USABLE 1
+#define MEMORY_MAP_RESERVED 2
+#define MEMORY_MAP_ACPI_RECLAIMABLE 3
+#define MEMORY_MAP_ACPI_NVS 4
+#define MEMORY_MAP_BAD 5
+
+// Bit of ExtendedAttributes that must be set for the entry to be taken into account
+#define MEMORY_MAP_ENTRY_VALID 1
+
+#define MEMORY_MAP_MAX_ENTRIES 64
+
+struct MemoryMapEntry {
+	uint64_t BaseAddress;			// + 0
+	uint64_t Length;				// + 8
+	uint32_t Type;					// + 16
+	uint32_t ExtendedAttributes;	// + 20. ACPI 3.0 onwards
+} __attribute__((packed));
+
+_Static_assert(sizeof(struct MemoryMapEntry) == 24, "MemoryMapEntry size must equal 24 bytes");
+
+struct MemoryMap {
+	uint32_t EntryCount;			// + 0. Zero if the BIOS does not support INT 15h, EAX=E820h
+	struct MemoryMapEntry Entries[MEMORY_MAP_MAX_ENTRIES];
+} __attribute__((packed));
+
+// Where the bootloader stores the memory map. Hosted builds may define it elsewhere
+#ifndef MEMORY_MAP_ADDRESS
+#define MEMORY_MAP_ADDRESS 0x0900
+#endif
+
+// Low memory word the payload checks the A20 line with, by comparing it with its
+// alias one MiB up. Hosted builds may define it elsewhere
+#ifndef A20_TEST_ADDRESS
+#define A20_TEST_ADDRESS 0x0500
+#endif
+
+// A pointer to the E820 memory map collected by the bootloader.
+static const struct MemoryMap* memoryMapPtr = (struct MemoryMap*) MEMORY_MAP_ADDRESS;
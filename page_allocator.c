@@ -0,0 +1,200 @@
+#include <stdbool.h>
+
+#include "page_allocator.h"
+#include "memory_map.h"
+#include "baselib.h"
+
+// Page frames below 1 MiB are never handed out
+#define FIRST_PAGE (0x100000 / PAGE_SIZE)
+// One past the last page frame reachable with 32-bit addresses
+#define PAGE_LIMIT (0x100000000ULL / PAGE_SIZE)
+
+// One bit per page frame, counting from FIRST_PAGE. A set bit means that
+// the page frame is not available. The bitmap lives in usable memory itself
+static uint32_t* page_bitmap = NULL;
+static uint32_t page_count = 0;
+
+/*
+ * Gets the range of page frames, relative to FIRST_PAGE, of the specified memory
+ * map entry. If usable is true, the entry must be usable RAM, and only the page
+ * frames that lie completely inside it are included. Otherwise, the entry must be
+ * of any other type, and every page frame that overlaps it is included. The end of
+ * the range is exclusive. Returns false if the entry is not of the requested kind,
+ * or no such page frame exists.
+ */
+static bool entry_pages(const struct MemoryMapEntry* entry, bool usable, uint32_t* first, uint32_t* end);
+
+/*
+ * Returns whether the A20 line is enabled. The bootloader enables it on a best-effort
+ * basis, and while it is disabled, every address above 1 MiB wraps around to the
+ * memory below.
+ */
+static bool a20_enabled(void);
+
+/*
+ * Marks the specified page frames, relative to FIRST_PAGE, as used or free.
+ */
+static void mark_pages(uint32_t first, uint32_t count, bool used);
+
+bool entry_pages(const struct MemoryMapEntry* entry, bool usable, uint32_t* first, uint32_t* end) {
+	if ((entry->Type == MEMORY_MAP_USABLE) != usable || (entry->ExtendedAttributes & MEMORY_MAP_ENTRY_VALID) == 0) {
+		return false;
+	}
+
+	uint64_t start = entry->BaseAddress;
+	uint64_t top = start + entry->Length;
+
+	// Usable ranges are rounded inwards, and the rest outwards
+	if (usable) {
+		start += PAGE_SIZE - 1;
+	} else {
+		top += PAGE_SIZE - 1;
+	}
+
+	uint64_t first_page = start / PAGE_SIZE;
+	uint64_t end_page = top / PAGE_SIZE;
+
+	if (first_page < FIRST_PAGE) {
+		first_page = FIRST_PAGE;
+	}
+
+	if (end_page > PAGE_LIMIT) {
+		end_page = PAGE_LIMIT;
+	}
+
+	if (first_page >= end_page) {
+		return false;
+	}
+
+	*first = first_page - FIRST_PAGE;
+	*end = end_page - FIRST_PAGE;
+	return true;
+}
+
+bool a20_enabled(void) {
+	volatile uint32_t* low = (volatile uint32_t*) A20_TEST_ADDRESS;
+	volatile uint32_t* high = (volatile uint32_t*) (A20_TEST_ADDRESS + 0x100000);
+	uint32_t saved = *high;
+
+	// If the addresses wrap around, writing one also changes the other
+	*high = ~*low;
+	bool enabled = *high != *low;
+	*high = saved;
+
+	return enabled;
+}
+
+void mark_pages(uint32_t first, uint32_t count, bool used) {
+	for (uint32_t page = first; page < first + count; ++page) {
+		if (used) {
+			page_bitmap[page / 32] |= 1UL << (page % 32);
+		} else {
+			page_bitmap[page / 32] &= ~(1UL << (page % 32));
+		}
+	}
+}
+
+void setup_page_allocator(void) {
+	uint32_t first;
+	uint32_t end;
+	uint32_t reserved_end;
+	uint32_t bitmap_first = 0;
+	uint32_t entry_count = memoryMapPtr->EntryCount;
+
+	if (entry_count > MEMORY_MAP_MAX_ENTRIES) {
+		entry_count = MEMORY_MAP_MAX_ENTRIES;
+	}
+
+	// Memory above 1 MiB would overwrite the memory below
+	if (!a20_enabled()) {
+		return;
+	}
+
+	// Track every page frame up to the end of the highest usable range
+	for (uint32_t i = 0; i < entry_count; ++i) {
+		if (entry_pages(&memoryMapPtr->Entries[i], true, &first, &end) && end > page_count) {
+			page_count = end;
+		}
+	}
+
+	// Put the bitmap at the lowest page frames of a usable range that no reserved
+	// range overlaps, as the bitmap is written before those overlaps are marked
+	size_t bitmap_size = (page_count + 31) / 32 * sizeof(uint32_t);
+	uint32_t bitmap_pages = PAGES_FOR(bitmap_size);
+
+	for (uint32_t i = 0; i < entry_count && page_bitmap == NULL; ++i) {
+		if (!entry_pages(&memoryMapPtr->Entries[i], true, &bitmap_first, &end)) {
+			continue;
+		}
+
+		for (uint32_t j = 0; j < entry_count && bitmap_first + bitmap_pages <= end; ++j) {
+			if (entry_pages(&memoryMapPtr->Entries[j], false, &first, &reserved_end) &&
+				first < bitmap_first + bitmap_pages && reserved_end > bitmap_first) {
+				// Move past the reserved range, and check every entry again
+				bitmap_first = reserved_end;
+				j = -1;
+			}
+		}
+
+		if (bitmap_first + bitmap_pages <= end) {
+			page_bitmap = (uint32_t*) ((bitmap_first + FIRST_PAGE) * PAGE_SIZE);
+		}
+	}
+
+	if (page_bitmap == NULL) {
+		// No memory map, or no usable RAM above 1 MiB with room for the bitmap
+		page_count = 0;
+		return;
+	}
+
+	// Holes and reserved ranges are not available, so start with everything
+	// used and then free what the memory map reports as usable
+	memset(page_bitmap, 0xFF, bitmap_size);
+
+	for (uint32_t i = 0; i < entry_count; ++i) {
+		if (entry_pages(&memoryMapPtr->Entries[i], true, &first, &end)) {
+			mark_pages(first, end - first, false);
+		}
+	}
+
+	// Usable ranges may overlap reserved ones, and then the overlap is not available
+	for (uint32_t i = 0; i < entry_count; ++i) {
+		if (entry_pages(&memoryMapPtr->Entries[i], false, &first, &end) && first < page_count) {
+			mark_pages(first, (end < page_count ? end : page_count) - first, true);
+		}
+	}
+
+	mark_pages(bitmap_first, bitmap_pages, true);
+}
+
+void* allocate_pages(size_t count) {
+	uint32_t free_run = 0;
+
+	for (uint32_t page = 0; page < page_count && count > 0; ++page) {
+		if (page % 32 == 0 && page_bitmap[page / 32] == 0xFFFFFFFF) {
+			// Skip fully used words at once
+			free_run = 0;
+			page += 31;
+		} else if ((page_bitmap[page / 32] & (1UL << (page % 32))) != 0) {
+			free_run = 0;
+		} else if (++free_run == count) {
+			uint32_t first = page + 1 - count;
+
+			mark_pages(first, count, true);
+			return (void*) ((first + FIRST_PAGE) * PAGE_SIZE);
+		}
+	}
+
+	return NULL;
+}
+
+void free_pages(void* address, size_t count) {
+	uint32_t first = (uint32_t) address / PAGE_SIZE;
+
+	// Memory below 1 MiB is not tracked, and its bit would be out of the bitmap
+	if (first < FIRST_PAGE || first - FIRST_PAGE + count > page_count) {
+		return;
+	}
+
+	mark_pages(first - FIRST_PAGE, count, false);
+}
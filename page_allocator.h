@@ -0,0 +1,35 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define PAGE_SIZE 4096
+
+/*
+ * Returns how many pages are needed to hold the specified number of bytes.
+ */
+#define PAGES_FOR(bytes) (((bytes) + PAGE_SIZE - 1) / PAGE_SIZE)
+
+/*
+ * Initializes the page frame allocator, making available every usable page of
+ * physical memory above 1 MiB and below 4 GiB that the BIOS memory map reports.
+ * Memory below 1 MiB is never handed out, as the payload manages it by itself,
+ * and nothing is if the A20 line is disabled, so memory above 1 MiB wraps around.
+ * This function should be called only once, before any other page allocator
+ * function.
+ */
+void setup_page_allocator(void);
+
+/*
+ * Allocates the specified number of physically contiguous pages, returning the
+ * address of the first one, which is aligned to PAGE_SIZE. Returns NULL if
+ * there is not enough contiguous free memory, or count is zero.
+ */
+void* allocate_pages(size_t count);
+
+/*
+ * Frees pages previously returned by allocate_pages, so they can be allocated again.
+ * count must be the same that was used to allocate them. Pages the allocator does
+ * not manage, like the ones below 1 MiB, are left alone.
+ */
+void free_pages(void* address, size_t count);
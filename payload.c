@@ -1,31 +1,100 @@
 #include "vbe.h"
 #include "drawing.h"
-#include "rle.h"
+#include "compositor.h"
+#include "atlas.h"
 #include "baselib.h"
 #include "interrupts.h"
+#include "page_allocator.h"
+#include "clock.h"
+#include "serial.h"
 #include "assets/build/assets.h"
 
-#define TICKS_INTERVAL 33 // 16.5 ms = 60.61 Hz (FPS for our purposes)
+#define FRAME_INTERVAL_NS (33 * NS_PER_MS / 2) // 16.5 ms = 60.61 Hz (FPS for our purposes)
 
-static uint16_t remaining_ticks = TICKS_INTERVAL;
+// Resolution the scene layout was designed for
+#define LAYOUT_WIDTH 640
+#define LAYOUT_HEIGHT 480
+
+// Absolute time at which the next frame is due. Adding intervals to the previous
+// deadline, instead of to the current time, keeps frames from drifting
+static uint64_t next_frame_ns;
 static uint8_t fade_cc = 0;
 
-static struct PbmImage balloons_image;
-static struct PbmImage happy_text_image;
-static struct PbmImage birthday_text_image;
-static struct PbmImage smile_image;
-static struct PbmPalette image_palette;
-
-// 64 KiB maximum size for these buffers.
-// The first address is 64 Ki positions below ISRs
-static void* balloons_decompress_buf = (void*) 0x6FEF0;
-#define BALLOONS_DECOMPRESS_BUF_SIZE 32768
-static void* happy_text_decompress_buf = (void*) 0x77EF0;
-#define HAPPY_TEXT_DECOMPRESS_BUF_SIZE 4096
-static void* birthday_text_decompress_buf = (void*) 0x78EF0;
-#define BIRTHDAY_TEXT_DECOMPRESS_BUF_SIZE 4096
-static void* smile_decompress_buf = (void*) 0x79EF0;
-#define SMILE_DECOMPRESS_BUF_SIZE 512
+// Scale factor from the layout resolution to the current video mode
+static uint16_t scene_scale;
+
+// A rectangle of the scene layout, relative to the center of the screen
+struct LayoutRect {
+	int16_t x;
+	int16_t y;
+	uint16_t width;
+	uint16_t height;
+};
+
+// Rectangles that contain the balloons of the background image
+static const struct LayoutRect balloon_rects[] = {
+	{ -154, -240, 330, 301 },
+	{ -176, -92, 22, 111 },
+	{ 31, 61, 72, 25 },
+	{ -42, 98, 56, 22 },
+	{ 14, 88, 15, 17 },
+	{ 28, 82, 4, 6 },
+	{ -48, 103, 6, 5 },
+	{ -52, 98, 4, 4 },
+};
+#define BALLOON_RECT_COUNT (sizeof(balloon_rects) / sizeof(struct LayoutRect))
+_Static_assert(BALLOON_RECT_COUNT <= REGION_MAX_RECTS, "Too many balloon rectangles for a region");
+
+// Screen region covered by the balloon rectangles
+static struct Region balloons_region;
+
+// Images of the atlas, in the same order as ATLAS_IMAGES in assets/Makefile
+enum AtlasImage {
+	BALLOONS_IMAGE,
+	SMILE_IMAGE,
+	IMAGE_COUNT
+};
+
+static struct PbmImage images[IMAGE_COUNT];
+static struct PbmPalette image_palette = { 0, 0, 0, 255, 255, 255 };
+
+// The balloons image again, with the palette that colors the balloon lines
+static struct PbmImage balloon_lines_image;
+static struct PbmPalette balloon_lines_palette = { 0, 0, 0, 255, 255, 255 };
+
+static struct Font happy_font;
+static struct Font birthday_font;
+
+static const char happy_text[] = "FELIZ";
+static const char birthday_text[] = "CUMPLEA\xD1OS";
+
+// Layers of the scene. Fades change their alpha, so only the changed layers are
+// drawn again. Their positions depend on the video mode, so setup_layers sets them
+static struct Layer paper_layer = { .kind = LAYER_FILL, .z = 0, .color = { 255, 255, 255 } };
+// The balloon lines are the low color of the image, so the paper shows through the rest
+static struct Layer balloons_layer = {
+	.kind = LAYER_IMAGE, .z = 1, .alpha = 255, .image = &images[BALLOONS_IMAGE], .transparency = LAYER_HIGH_TRANSPARENT
+};
+// Colors the balloon lines inside the balloon rectangles, over the balloons layer.
+// It is invisible until the balloons change color
+static struct Layer balloon_lines_layer = {
+	.kind = LAYER_IMAGE, .z = 1, .image = &balloon_lines_image, .transparency = LAYER_HIGH_TRANSPARENT,
+	.clip = &balloons_region
+};
+static struct Layer smile_layer = {
+	.kind = LAYER_IMAGE, .z = 2, .alpha = 255, .image = &images[SMILE_IMAGE], .transparency = LAYER_OPAQUE
+};
+// Text is drawn on a white box, which hides the balloon strings behind it
+static struct Layer happy_box_layer = { .kind = LAYER_FILL, .z = 2, .alpha = 255, .color = { 255, 255, 255 } };
+static struct Layer happy_text_layer = { .kind = LAYER_TEXT, .z = 3, .font = &happy_font, .text = happy_text };
+static struct Layer birthday_box_layer = { .kind = LAYER_FILL, .z = 2, .alpha = 255, .color = { 255, 255, 255 } };
+static struct Layer birthday_text_layer = { .kind = LAYER_TEXT, .z = 3, .font = &birthday_font, .text = birthday_text };
+
+// 64 KiB maximum size for this buffer.
+// The first address is 64 Ki positions below ISRs.
+// It is only used if no memory above 1 MiB could be allocated
+static void* atlas_buf = (void*) 0x6FEF0;
+#define ATLAS_BUF_SIZE 32768
 
 static void initial_fade(void);
 static void happy_text_fade(void);
@@ -33,38 +102,87 @@ static void birthday_text_fade(void);
 static void random_balloons_color(void);
 
 /*
- * Decompresses the specified RLE data to the given buffer, and decodes it as a PBM image.
- * If not successful, this function draws error color codes and never returns.
+ * Makes the specified function the tick function of the current phase of the show.
+ * Benchmark builds report the phase change through the serial port, and wait for
+ * the host to acknowledge it, so it can take a screenshot. Then they measure every
+ * frame of the phase.
+ */
+static void set_phase(void (*tick_function)(void));
+
+#if BENCHMARK
+static void (*phase_tick_function)(void);
+static uint8_t phase = 0;
+// Time spent waiting for the host since the show started
+static uint64_t waited_ns = 0;
+
+/*
+ * Tick function of benchmark builds. Runs the tick function of the current phase,
+ * and reports how long it took through the serial port if it drew a frame.
+ */
+static void benchmark_tick(void);
+#endif
+
+/*
+ * Scales a length or offset of the scene layout to the current video mode,
+ * rounding up.
+ */
+static int16_t scaled(int16_t length);
+
+/*
+ * Returns the screen coordinate of a horizontal or vertical scene layout offset,
+ * relative to the center of the screen.
+ */
+static uint16_t layout_x(int16_t x);
+static uint16_t layout_y(int16_t y);
+
+/*
+ * Places the scene layers on the screen, and adds the ones visible from the start
+ * to the compositor.
+ */
+static void setup_layers(void);
+
+/*
+ * Decompresses the image atlas to a buffer, and points the images to it. The buffer
+ * is allocated from memory above 1 MiB when possible, and the specified fallback
+ * buffer is used otherwise. If not successful, this function draws an error color
+ * code and never returns.
+ */
+static void load_atlas_or_halt(const uint8_t* data, size_t size, void* buf, size_t buf_size);
+
+/*
+ * Loads the specified font data. If not successful, this function draws an
+ * error color code and never returns.
  */
-static void decompress_and_decode_pbm(void* data, size_t size, void* buf, size_t buf_size, struct PbmImage* image);
+static void load_font_or_halt(const uint8_t* data, size_t size, struct Font* font);
 
 /**
  * Entry point of the application. The bootloader will jump to the first instruction
  * of this function, at 0x8000.
  */
 void start(void) {
-	// Load images
-	decompress_and_decode_pbm(
-		balloons_pbm_stripped_rle, balloons_pbm_stripped_rle_len,
-		balloons_decompress_buf, BALLOONS_DECOMPRESS_BUF_SIZE, &balloons_image
-	);
-	decompress_and_decode_pbm(
-		happy_text_pbm_stripped_rle, happy_text_pbm_stripped_rle_len,
-		happy_text_decompress_buf, HAPPY_TEXT_DECOMPRESS_BUF_SIZE, &happy_text_image
-	);
-	decompress_and_decode_pbm(
-		birthday_text_pbm_stripped_rle, birthday_text_pbm_stripped_rle_len,
-		birthday_text_decompress_buf, BIRTHDAY_TEXT_DECOMPRESS_BUF_SIZE, &birthday_text_image
-	);
-	decompress_and_decode_pbm(
-		smile_pbm_stripped_rle, smile_pbm_stripped_rle_len,
-		smile_decompress_buf, SMILE_DECOMPRESS_BUF_SIZE, &smile_image
-	);
+	setup_page_allocator();
+
+	// Load images and fonts
+	load_atlas_or_halt(images_atlas, images_atlas_len, atlas_buf, ATLAS_BUF_SIZE);
+	load_font_or_halt(happy_text_font, happy_text_font_len, &happy_font);
+	load_font_or_halt(birthday_text_font, birthday_text_font_len, &birthday_font);
+
+	// Fill as much of the screen as possible, keeping the aspect ratio
+	scene_scale = modeInfoBlockPtr->XResolution * SCALE_ONE / LAYOUT_WIDTH;
+	if (modeInfoBlockPtr->YResolution * SCALE_ONE / LAYOUT_HEIGHT < scene_scale) {
+		scene_scale = modeInfoBlockPtr->YResolution * SCALE_ONE / LAYOUT_HEIGHT;
+	}
 
 	// Make sure everything is black
 	fill(0, 0, modeInfoBlockPtr->XResolution, modeInfoBlockPtr->YResolution, 0, 0, 0);
+	setup_layers();
 
-	setup_interrupts(&initial_fade);
+	setup_clock();
+	next_frame_ns = now_ns() + FRAME_INTERVAL_NS;
+#if BENCHMARK
+	setup_serial();
+#endif
+	set_phase(&initial_fade);
 
 	// Wait indefinitely until the next tick
 	while (true) {
@@ -72,223 +190,228 @@ void start(void) {
 	}
 }
 
-void decompress_and_decode_pbm(void* data, size_t size, void* buf, size_t buf_size, struct PbmImage* image) {
-	image->width = 0;
-	image->palette = &image_palette;
+void set_phase(void (*tick_function)(void)) {
+#if BENCHMARK
+	phase_tick_function = tick_function;
+	++phase;
+
+	serial_write("phase ");
+	serial_write_hex(phase);
+	serial_write("\n");
+
+	// Don't let the wait push the show behind its deadlines
+	uint64_t wait_start_ns = now_ns();
+	serial_read();
+	uint64_t wait_ns = now_ns() - wait_start_ns;
+	waited_ns += wait_ns;
+	next_frame_ns += wait_ns;
+
+	setup_interrupts(&benchmark_tick);
+#else
+	setup_interrupts(tick_function);
+#endif
+}
+
+#if BENCHMARK
+void benchmark_tick(void) {
+	uint8_t frame_phase = phase;
+	uint64_t deadline_ns = next_frame_ns;
+	uint64_t start_ns = now_ns() - waited_ns;
+
+	phase_tick_function();
+
+	// Phases move the deadline forward whenever they draw a frame. The time
+	// since the CPU was reset, without the waits for the host, goes last, so
+	// the host can tell the boot to first frame latency from the first frame
+	if (next_frame_ns != deadline_ns) {
+		uint64_t end_ns = now_ns() - waited_ns;
+
+		serial_write("frame ");
+		serial_write_hex(frame_phase);
+		serial_write(" ");
+		serial_write_hex(end_ns - start_ns);
+		serial_write(" ");
+		serial_write_hex(end_ns);
+		serial_write("\n");
+	}
+}
+#endif
+
+int16_t scaled(int16_t length) {
+	// Arithmetic shift, so negative offsets are rounded up too
+	return (length * scene_scale + SCALE_ONE - 1) >> 8;
+}
+
+uint16_t layout_x(int16_t x) {
+	return modeInfoBlockPtr->XResolution / 2 + scaled(x);
+}
+
+uint16_t layout_y(int16_t y) {
+	return modeInfoBlockPtr->YResolution / 2 + scaled(y);
+}
+
+void setup_layers(void) {
+	paper_layer.width = modeInfoBlockPtr->XResolution;
+	paper_layer.height = modeInfoBlockPtr->YResolution;
+
+	balloons_layer.x = layout_x(-(int16_t) images[BALLOONS_IMAGE].width);
+	balloons_layer.y = layout_y(-(int16_t) images[BALLOONS_IMAGE].height / 2);
+	balloons_layer.x_scale = scene_scale * 2;
+	balloons_layer.y_scale = scene_scale;
+
+	struct Rect rects[BALLOON_RECT_COUNT];
+
+	for (size_t i = 0; i < BALLOON_RECT_COUNT; ++i) {
+		rects[i].x = layout_x(balloon_rects[i].x);
+		rects[i].y = layout_y(balloon_rects[i].y);
+		rects[i].width = scaled(balloon_rects[i].width);
+		rects[i].height = scaled(balloon_rects[i].height);
+	}
+
+	set_region_rects(&balloons_region, rects, BALLOON_RECT_COUNT);
+
+	balloon_lines_image = images[BALLOONS_IMAGE];
+	balloon_lines_image.palette = &balloon_lines_palette;
+	balloon_lines_layer.x = balloons_layer.x;
+	balloon_lines_layer.y = balloons_layer.y;
+	balloon_lines_layer.x_scale = balloons_layer.x_scale;
+	balloon_lines_layer.y_scale = balloons_layer.y_scale;
+
+	smile_layer.x = layout_x(-246);
+	smile_layer.y = layout_y(126);
+	smile_layer.x_scale = scene_scale * 2;
+	smile_layer.y_scale = scene_scale;
+
+	happy_text_layer.x = happy_box_layer.x = layout_x(-305);
+	happy_text_layer.y = happy_box_layer.y = layout_y(-228);
+	happy_text_layer.x_scale = scene_scale * 2;
+	happy_text_layer.y_scale = scene_scale;
+	happy_box_layer.width = scaled(text_width(&happy_font, happy_text) * 2);
+	happy_box_layer.height = scaled(happy_font.height);
+
+	birthday_text_layer.x = birthday_box_layer.x = layout_x(-30);
+	birthday_text_layer.y = birthday_box_layer.y = layout_y(175);
+	birthday_text_layer.x_scale = scene_scale * 2;
+	birthday_text_layer.y_scale = scene_scale;
+	birthday_box_layer.width = scaled(text_width(&birthday_font, birthday_text) * 2);
+	birthday_box_layer.height = scaled(birthday_font.height);
+
+	add_layer(&paper_layer);
+	add_layer(&balloons_layer);
+	add_layer(&balloon_lines_layer);
+}
+
+void load_atlas_or_halt(const uint8_t* data, size_t size, void* buf, size_t buf_size) {
+	void* pages = allocate_pages(PAGES_FOR(buf_size));
+	if (pages != NULL) {
+		buf = pages;
+	}
 
-	size_t rle_decompressed_data_size = decompress(data, size, buf, buf_size);
-	if (rle_decompressed_data_size == 0) {
+	if (!load_atlas(data, size, buf, buf_size, images, IMAGE_COUNT)) {
 		fill(0, 0, modeInfoBlockPtr->XResolution, modeInfoBlockPtr->YResolution, 255, 255, 0);
 		halt(true);
 	}
 
-	decode_pbm(buf, rle_decompressed_data_size, image);
-	if (image->width == 0) {
-		fill(0, 0, modeInfoBlockPtr->XResolution, modeInfoBlockPtr->YResolution, 255, 127, 0);
+	for (uint8_t i = 0; i < IMAGE_COUNT; ++i) {
+		images[i].palette = &image_palette;
+	}
+}
+
+void load_font_or_halt(const uint8_t* data, size_t size, struct Font* font) {
+	if (!load_font(font, data, size)) {
+		fill(0, 0, modeInfoBlockPtr->XResolution, modeInfoBlockPtr->YResolution, 255, 0, 255);
 		halt(true);
 	}
 }
 
 void initial_fade(void) {
-	if (--remaining_ticks == 0) {
-		uint8_t old_fade_cc = fade_cc;
+	if (now_ns() >= next_frame_ns) {
 		fade_cc += 3; // So fade lasts 1.402 s at 60 FPS
 
-		// Replace previous fading color
-		replace_color(
-			old_fade_cc, old_fade_cc, old_fade_cc,
-			fade_cc, fade_cc, fade_cc,
-			0, 0, modeInfoBlockPtr->XResolution, modeInfoBlockPtr->YResolution
-		);
-
-		if (fade_cc == 3) {
-			// Draw background image
-			image_palette.low_r = 0;
-			image_palette.low_g = 0;
-			image_palette.low_b = 0;
-			image_palette.high_r = fade_cc;
-			image_palette.high_g = fade_cc;
-			image_palette.high_b = fade_cc;
-
-			draw_pbm_image(
-				&balloons_image,
-				modeInfoBlockPtr->XResolution / 2 - balloons_image.width,
-				modeInfoBlockPtr->YResolution / 2 - balloons_image.height / 2,
-				2
-			);
-		}
+		// Fade the paper in from black, behind the balloon lines
+		paper_layer.alpha = fade_cc;
+		update_layer(&paper_layer);
+		compose();
 
 		// Proceed to the next phase
 		if (fade_cc == 255) {
 			fade_cc = 252;
 
-			image_palette.low_r = fade_cc;
-			image_palette.low_g = fade_cc;
-			image_palette.low_b = fade_cc;
-			image_palette.high_r = 255;
-			image_palette.high_g = 255;
-			image_palette.high_b = 255;
-
-			draw_pbm_image(
-				&happy_text_image,
-				modeInfoBlockPtr->XResolution / 2 - 305,
-				modeInfoBlockPtr->YResolution / 2 - 228,
-				2
-			);
-
-			setup_interrupts(&happy_text_fade);
+			happy_text_layer.alpha = 255 - fade_cc;
+			add_layer(&happy_box_layer);
+			add_layer(&happy_text_layer);
+			compose();
+
+			set_phase(&happy_text_fade);
 		}
 
-		remaining_ticks = TICKS_INTERVAL;
+		next_frame_ns += FRAME_INTERVAL_NS;
 	}
 }
 
 static void happy_text_fade(void) {
-	if (--remaining_ticks == 0) {
-		uint8_t old_fade_cc = fade_cc;
+	if (now_ns() >= next_frame_ns) {
 		fade_cc -= 3;
 
-		// Replace previous fading color
-		replace_color(
-			old_fade_cc, old_fade_cc, old_fade_cc,
-			fade_cc, fade_cc, fade_cc,
-			modeInfoBlockPtr->XResolution / 2 - 305, modeInfoBlockPtr->YResolution / 2 - 228,
-			happy_text_image.width * 2, happy_text_image.height
-		);
+		happy_text_layer.alpha = 255 - fade_cc;
+		update_layer(&happy_text_layer);
+		compose();
 
 		if (fade_cc == 0) {
 			fade_cc = 252;
 
-			setup_interrupts(&birthday_text_fade);
+			set_phase(&birthday_text_fade);
 
-			remaining_ticks = 3000; // 1.5 s for fade start
+			next_frame_ns += 1500 * NS_PER_MS; // 1.5 s for fade start
 		} else {
-			remaining_ticks = TICKS_INTERVAL;
+			next_frame_ns += FRAME_INTERVAL_NS;
 		}
 	}
 }
 
 void birthday_text_fade(void) {
-	if (--remaining_ticks == 0) {
+	if (now_ns() >= next_frame_ns) {
 		uint8_t old_fade_cc = fade_cc;
 		fade_cc -= 3;
 
-		// First tick, draw image
+		birthday_text_layer.alpha = 255 - fade_cc;
+
+		// First tick, show text
 		if (old_fade_cc == 252) {
-			draw_pbm_image(
-				&birthday_text_image,
-				modeInfoBlockPtr->XResolution / 2 - 30,
-				modeInfoBlockPtr->YResolution / 2 + 175,
-				2
-			);
+			add_layer(&birthday_box_layer);
+			add_layer(&birthday_text_layer);
+		} else {
+			update_layer(&birthday_text_layer);
 		}
 
-		// Replace previous fading color
-		replace_color(
-			old_fade_cc, old_fade_cc, old_fade_cc,
-			fade_cc, fade_cc, fade_cc,
-			modeInfoBlockPtr->XResolution / 2 - 30, modeInfoBlockPtr->YResolution / 2 + 175,
-			birthday_text_image.width * 2, birthday_text_image.height
-		);
+		compose();
 
 		if (fade_cc == 0) {
-			setup_interrupts(&random_balloons_color);
+			set_phase(&random_balloons_color);
 		}
 
-		remaining_ticks = TICKS_INTERVAL;
+		next_frame_ns += FRAME_INTERVAL_NS;
 	}
 }
 
 void random_balloons_color(void) {
-	static uint8_t previous_r = 0;
-	static uint8_t previous_g = 0;
-	static uint8_t previous_b = 0;
-
 	static bool smile_not_drawn = true;
 
-	if (--remaining_ticks == 0) {
-		uint8_t new_r = (uint8_t) (rand() % 200);
-		uint8_t new_g = (uint8_t) (rand() % 200);
-		uint8_t new_b = (uint8_t) (rand() % 200);
-
-		replace_color(
-			previous_r, previous_g, previous_b,
-			new_r, new_g, new_b,
-			modeInfoBlockPtr->XResolution / 2 - 154, modeInfoBlockPtr->YResolution / 2 - 240,
-			330, 301
-		);
-
-		replace_color(
-			previous_r, previous_g, previous_b,
-			new_r, new_g, new_b,
-			modeInfoBlockPtr->XResolution / 2 - 176, modeInfoBlockPtr->YResolution / 2 - 92,
-			22, 111
-		);
-
-		replace_color(
-			previous_r, previous_g, previous_b,
-			new_r, new_g, new_b,
-			modeInfoBlockPtr->XResolution / 2 + 31, modeInfoBlockPtr->YResolution / 2 + 61,
-			72, 25
-		);
-
-		replace_color(
-			previous_r, previous_g, previous_b,
-			new_r, new_g, new_b,
-			modeInfoBlockPtr->XResolution / 2 - 42, modeInfoBlockPtr->YResolution / 2 + 98,
-			56, 22
-		);
-
-		replace_color(
-			previous_r, previous_g, previous_b,
-			new_r, new_g, new_b,
-			modeInfoBlockPtr->XResolution / 2 + 14, modeInfoBlockPtr->YResolution / 2 + 88,
-			15, 17
-		);
-
-		replace_color(
-			previous_r, previous_g, previous_b,
-			new_r, new_g, new_b,
-			modeInfoBlockPtr->XResolution / 2 + 28, modeInfoBlockPtr->YResolution / 2 + 82,
-			4, 6
-		);
-
-		replace_color(
-			previous_r, previous_g, previous_b,
-			new_r, new_g, new_b,
-			modeInfoBlockPtr->XResolution / 2 - 48, modeInfoBlockPtr->YResolution / 2 + 103,
-			6, 5
-		);
-
-		replace_color(
-			previous_r, previous_g, previous_b,
-			new_r, new_g, new_b,
-			modeInfoBlockPtr->XResolution / 2 - 52, modeInfoBlockPtr->YResolution / 2 + 98,
-			4, 4
-		);
+	if (now_ns() >= next_frame_ns) {
+		balloon_lines_palette.low_r = (uint8_t) (rand() % 200);
+		balloon_lines_palette.low_g = (uint8_t) (rand() % 200);
+		balloon_lines_palette.low_b = (uint8_t) (rand() % 200);
+		balloon_lines_layer.alpha = 255;
+		update_layer(&balloon_lines_layer);
 
 		if (rand() % 60 == 3 && smile_not_drawn) {
-			image_palette.low_r = 0;
-			image_palette.low_g = 0;
-			image_palette.low_b = 0;
-			image_palette.high_r = 255;
-			image_palette.high_g = 255;
-			image_palette.high_b = 255;
-
-			draw_pbm_image(
-				&smile_image,
-				modeInfoBlockPtr->XResolution / 2 - 246,
-				modeInfoBlockPtr->YResolution / 2 + 126,
-				2
-			);
+			add_layer(&smile_layer);
 
 			smile_not_drawn = false;
 		}
 
-		previous_r = new_r;
-		previous_g = new_g;
-		previous_b = new_b;
+		compose();
 
-		remaining_ticks = (uint16_t) (rand() % 600) + 400; // 0.5 seconds maximum, 0.2 seconds minimum
+		next_frame_ns += (rand() % 300 + 200) * NS_PER_MS; // 0.5 seconds maximum, 0.2 seconds minimum
 	}
 }
@@ -0,0 +1,96 @@
+; Intel 80386 compliance
+CPU 386
+BITS 32
+; Position independent. The bootloader jumps to this stub at 0x8000,
+; and it unpacks the compressed payload over itself
+ORG 0
+
+; Scratch memory this stub and the compressed payload are moved to
+; before unpacking. It is free to use until the payload starts
+SCRATCH_ADDRESS EQU 0x70000
+; Address the payload is linked to run at
+PAYLOAD_ADDRESS EQU 0x8000
+
+; The compressor output is appended right after this stub: the
+; uncompressed payload size, the compressed stream size, and the
+; compressed stream itself
+uncompressed_size EQU stub_end
+compressed_size EQU stub_end + 4
+compressed_data EQU stub_end + 8
+
+; ------------------
+; Self-extractor
+; ------------------
+
+stub:
+	; Get the address this code is running at
+	CALL .get_address
+	.get_address:
+		POP esi
+		SUB esi, .get_address - stub
+
+	; Move everything out of the way of the unpacked payload
+	MOV edi, SCRATCH_ADDRESS
+	MOV ecx, dword [esi + compressed_size - stub]
+	ADD ecx, compressed_data - stub
+	CLD
+	REP MOVSB
+
+	; Continue executing the copy
+	MOV eax, SCRATCH_ADDRESS + unpack - stub
+	JMP eax
+
+; LZSS decoder. The compressed stream is made of groups of a flag
+; byte followed by up to 8 items, as described by the flag bits from
+; the least significant one. A set bit means a literal byte, and a
+; clear bit means a 16-bit little endian match reference, with the
+; distance minus one in the upper 12 bits and the length minus three
+; in the lower 4 bits.
+unpack:
+	MOV esi, SCRATCH_ADDRESS + compressed_data - stub
+	MOV edi, PAYLOAD_ADDRESS
+	MOV ebx, edi
+	ADD ebx, dword [SCRATCH_ADDRESS + uncompressed_size - stub]
+
+	.next_group:
+		LODSB
+		MOV dl, al ; Flags
+		MOV dh, 8 ; Items left in this group
+
+	.next_item:
+		CMP edi, ebx
+		JAE .done
+
+		SHR dl, 1
+		JNC .match
+
+		MOVSB
+		JMP .item_done
+
+	.match:
+		XOR eax, eax
+		LODSW
+		MOV ecx, eax
+		AND ecx, 0x0F
+		ADD ecx, 3 ; Length
+		SHR eax, 4
+		INC eax ; Distance
+
+		; Copy byte by byte, so overlapping matches repeat data
+		PUSH esi
+		MOV esi, edi
+		SUB esi, eax
+		REP MOVSB
+		POP esi
+
+	.item_done:
+		DEC dh
+		JNZ .next_item
+		JMP .next_group
+
+	.done:
+		; Jump to C!
+		MOV eax, PAYLOAD_ADDRESS
+		JMP eax
+
+stub_end:
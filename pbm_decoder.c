@@ -1,8 +1,6 @@
 #include "pbm_decoder.h"
 #include "baselib.h"
 
-static struct Pixel pixel;
-
 void decode_pbm(void* pbm_data, size_t size, struct PbmImage* pbm_struct) {
     uint8_t* pbm_data_ptr = (uint8_t*) pbm_data;
     uint8_t* previous_pbm_data_ptr;
@@ -66,40 +64,23 @@ void decode_pbm(void* pbm_data, size_t size, struct PbmImage* pbm_struct) {
             pbm_struct->width = width;
             pbm_struct->height = height;
             pbm_struct->raster_pos = pbm_data_ptr;
-            pbm_struct->current_row_pixel = 0;
+            pbm_struct->row_bytes = row_bytes;
         }
     }
 }
 
-struct Pixel* next_pixel(struct PbmImage* pbm_image) {
-    uint8_t current_byte = *(uint8_t*) pbm_image->raster_pos;
-    uint8_t current_byte_index = 7 - (pbm_image->current_row_pixel % 8);
-
-    if (((current_byte >> current_byte_index) & 1) == 0) {
-        pixel.r = pbm_image->palette->low_r;
-        pixel.g = pbm_image->palette->low_g;
-        pixel.b = pbm_image->palette->low_b;
-    } else {
-        pixel.r = pbm_image->palette->high_r;
-        pixel.g = pbm_image->palette->high_g;
-        pixel.b = pbm_image->palette->high_b;
-    }
-
-    unsigned int new_row_pixel = pbm_image->current_row_pixel + 1;
-    bool moved_to_next_row = new_row_pixel == pbm_image->width;
+void undo_pbm_row_delta(struct PbmImage* pbm_image) {
+    unsigned int width_bytes = pbm_image->width / 8 + (pbm_image->width % 8 == 0 ? 0 : 1);
+    uint8_t* row = (uint8_t*) pbm_image->raster_pos;
 
-    // We need to advance raster_pos (and reset the byte index)
-    // if the row ends here, or there are no more bits left in this byte
-    if (current_byte_index == 0 || moved_to_next_row) {
-        ++pbm_image->raster_pos;
-    }
+    // The first row is stored as-is. Every byte depends on the byte just
+    // above it, which was already restored
+    for (unsigned int j = 1; j < pbm_image->height; ++j) {
+        const uint8_t* previous_row = row;
+        row += pbm_image->row_bytes;
 
-    // We need to reset row pixel count if we moved to the next row
-    if (moved_to_next_row) {
-        new_row_pixel = 0;
+        for (unsigned int i = 0; i < width_bytes; ++i) {
+            row[i] ^= previous_row[i];
+        }
     }
-
-    pbm_image->current_row_pixel = new_row_pixel;
-
-    return &pixel;
 }
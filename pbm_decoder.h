@@ -16,7 +16,9 @@ struct PbmImage {
     unsigned int width;
     unsigned int height;
     void* raster_pos;
-    unsigned int current_row_pixel;
+    // Bytes from the start of a raster row to the start of the next one. Images
+    // of an atlas are rectangles of a wider raster, so they may skip some bytes
+    unsigned int row_bytes;
     struct PbmPalette* palette;
 };
 
@@ -39,9 +41,9 @@ struct Pixel {
 void decode_pbm(void* pbm_data, size_t size, struct PbmImage* pbm_struct);
 
 /*
- * Returns the next pixel of a previously decoded PBM image and
- * advances pointers.
- * If there are no more pixels, the behavior of this function is
- * undefined.
+ * Reverts, in place, the row delta pre-filter applied to the raster data of a
+ * decoded PBM image by the asset pipeline, which stores every row XORed with
+ * the previous one. Rows are restored from top to bottom, so this must be
+ * called exactly once per decoded image, and for atlases, on the whole atlas.
  */
-struct Pixel* next_pixel(struct PbmImage* pbm_image);
+void undo_pbm_row_delta(struct PbmImage* pbm_image);
@@ -0,0 +1,71 @@
+#include "serial.h"
+#include "baselib.h"
+
+#define COM1 0x3F8
+#define DATA (COM1 + 0)
+#define INTERRUPT_ENABLE (COM1 + 1) // Divisor high byte when DLAB is set
+#define FIFO_CONTROL (COM1 + 2)
+#define LINE_CONTROL (COM1 + 3)
+#define MODEM_CONTROL (COM1 + 4)
+#define LINE_STATUS (COM1 + 5)
+
+#define LINE_CONTROL_DLAB 0x80
+#define LINE_CONTROL_8N1 0x03
+#define LINE_STATUS_DATA_READY 0x01
+#define LINE_STATUS_TRANSMITTER_EMPTY 0x20
+
+// 115200 / divisor bauds
+#define BAUD_DIVISOR 1
+
+/*
+ * Sends a byte through the serial port, waiting for the transmitter to be ready.
+ */
+static void serial_write_byte(uint8_t byte);
+
+void setup_serial(void) {
+	outb(INTERRUPT_ENABLE, 0x00);
+	outb(LINE_CONTROL, LINE_CONTROL_DLAB);
+	outb(DATA, BAUD_DIVISOR & 0xFF);
+	outb(INTERRUPT_ENABLE, BAUD_DIVISOR >> 8);
+	outb(LINE_CONTROL, LINE_CONTROL_8N1);
+	outb(FIFO_CONTROL, 0xC7); // Enable and clear FIFOs, 14 bytes receive threshold
+	outb(MODEM_CONTROL, 0x03); // Data terminal ready, request to send
+}
+
+void serial_write_byte(uint8_t byte) {
+	while ((inb(LINE_STATUS) & LINE_STATUS_TRANSMITTER_EMPTY) == 0);
+
+	outb(DATA, byte);
+}
+
+void serial_write(const char* s) {
+	while (*s != '\0') {
+		serial_write_byte(*s++);
+	}
+}
+
+void serial_write_hex(uint64_t value) {
+	uint8_t shift = 60;
+
+	// Skip leading zeros, but keep the last digit
+	while (shift > 0 && (value >> shift) == 0) {
+		shift -= 4;
+	}
+
+	while (true) {
+		uint8_t digit = (value >> shift) & 0xF;
+		serial_write_byte(digit < 10 ? '0' + digit : 'a' + digit - 10);
+
+		if (shift == 0) {
+			break;
+		}
+
+		shift -= 4;
+	}
+}
+
+uint8_t serial_read(void) {
+	while ((inb(LINE_STATUS) & LINE_STATUS_DATA_READY) == 0);
+
+	return inb(DATA);
+}
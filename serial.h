@@ -0,0 +1,25 @@
+#pragma once
+
+#include <stdint.h>
+
+/*
+ * Configures the first serial port (COM1) for 115200 bauds, 8 data bits, no parity
+ * and one stop bit. Interrupts are not used: every function polls the port.
+ */
+void setup_serial(void);
+
+/*
+ * Sends a null terminated string through the serial port.
+ */
+void serial_write(const char* s);
+
+/*
+ * Sends the hexadecimal representation of a value through the serial port, without
+ * leading zeros. Hexadecimal is used so that no 64-bit division is needed.
+ */
+void serial_write_hex(uint64_t value);
+
+/*
+ * Waits until a byte is received through the serial port, and returns it.
+ */
+uint8_t serial_read(void);
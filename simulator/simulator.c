@@ -0,0 +1,466 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <inttypes.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/mman.h>
+
+#include "../vbe.h"
+#include "../memory_map.h"
+#include "../interrupts.h"
+#include "../clock.h"
+
+// Conventional memory the payload uses at fixed addresses: fallback buffers
+// and the data handed over by the bootloader (see the Makefile)
+#define CONVENTIONAL_MEMORY_START 0x10000
+#define CONVENTIONAL_MEMORY_END 0x80000
+
+// Page of the alias one MiB above the word the payload tests the A20 line with
+#define A20_TEST_PAGE ((A20_TEST_ADDRESS + 0x100000) & ~0xFFF)
+
+// RAM above 1 MiB reported as usable in the simulated memory map
+#define EXTENDED_MEMORY_SIZE (64 * 1024 * 1024)
+
+// BIOS data area field the payload seeds its pseudorandom number generator with,
+// among others: the number of BIOS timer ticks since midnight
+#define BIOS_TICK_COUNT_OFFSET 0x6C
+
+#define MAX_PHASES 16
+#define MAX_DUMPED_FRAMES 64
+
+// Bytes read and written by the payload, in and out of the framebuffer
+struct Traffic {
+    uint64_t framebuffer_read;
+    uint64_t framebuffer_written;
+    uint64_t other_read;
+    uint64_t other_written;
+};
+
+struct PhaseStats {
+    unsigned int frames;
+    struct Traffic traffic;
+};
+
+// Payload entry point, and the real functions the simulated ones wrap
+void start(void);
+void* __real_memcpy(void* dest, const void* src, size_t size);
+void* __real_memset(void* dest, int value, size_t size);
+
+static uint8_t* framebuffer;
+static size_t framebuffer_size;
+
+static uint64_t duration_ns = 10000000000ULL;
+static const char* dump_directory = ".";
+static unsigned int dumped_frames[MAX_DUMPED_FRAMES];
+static unsigned int dumped_frame_count = 0;
+static unsigned int dump_interval = 0;
+static bool verbose = false;
+static uint32_t seed = 0;
+
+static void (*irq_handlers[IRQ_LINES])(void);
+static uint32_t ticks = 0;
+static uint64_t simulated_ns = 0;
+static bool timeline_running = false;
+
+// Phase 0 is everything start() does before the first tick. A new phase begins
+// whenever the payload sets a different tick function
+static unsigned int phase = 0;
+static unsigned int tick_phase = 0;
+static struct PhaseStats phase_stats[MAX_PHASES];
+
+static unsigned int frame = 0;
+static struct Traffic tick_traffic;
+
+/*
+ * Accounts a payload memory access of size bytes, starting at address.
+ */
+static void count_access(uintptr_t address, size_t size, bool write);
+
+/*
+ * Runs the tick function for every PIT tick until the simulated duration ends,
+ * then prints the statistics and exits.
+ */
+static void run_timeline(void);
+
+/*
+ * Accounts the memory traffic of the tick that just ended. Ticks that access the
+ * framebuffer are frames, which are dumped if requested.
+ */
+static void end_tick(void);
+
+/*
+ * Writes the framebuffer contents to a PPM file named after the frame number.
+ * Returns false on error.
+ */
+static bool dump_frame(unsigned int number);
+
+static void print_statistics(void);
+static void print_usage(const char* program);
+static bool parse_frame_list(char* list);
+static bool setup_memory(uint16_t width, uint16_t height);
+
+void count_access(uintptr_t address, size_t size, bool write) {
+    uintptr_t framebuffer_start = (uintptr_t) framebuffer;
+    uintptr_t framebuffer_end = framebuffer_start + framebuffer_size;
+    uintptr_t start = address > framebuffer_start ? address : framebuffer_start;
+    uintptr_t end = address + size < framebuffer_end ? address + size : framebuffer_end;
+    size_t inside = start < end ? end - start : 0;
+
+    if (write) {
+        tick_traffic.framebuffer_written += inside;
+        tick_traffic.other_written += size - inside;
+    } else {
+        tick_traffic.framebuffer_read += inside;
+        tick_traffic.other_read += size - inside;
+    }
+}
+
+// Hooks called by the code generated with -fsanitize=thread before every access
+#define ACCESS_HOOKS(size) \
+    void __tsan_read##size(uintptr_t address) { count_access(address, size, false); } \
+    void __tsan_write##size(uintptr_t address) { count_access(address, size, true); } \
+    void __tsan_unaligned_read##size(uintptr_t address) { count_access(address, size, false); } \
+    void __tsan_unaligned_write##size(uintptr_t address) { count_access(address, size, true); }
+
+ACCESS_HOOKS(1)
+ACCESS_HOOKS(2)
+ACCESS_HOOKS(4)
+ACCESS_HOOKS(8)
+ACCESS_HOOKS(16)
+
+void __tsan_read_range(uintptr_t address, size_t size) {
+    count_access(address, size, false);
+}
+
+void __tsan_write_range(uintptr_t address, size_t size) {
+    count_access(address, size, true);
+}
+
+void __tsan_init(void) {
+}
+
+// baselib.c functions that are implemented with inline assembly, so they are not instrumented
+void* __wrap_memcpy(void* dest, const void* src, size_t size) {
+    count_access((uintptr_t) src, size, false);
+    count_access((uintptr_t) dest, size, true);
+    return __real_memcpy(dest, src, size);
+}
+
+void* __wrap_memset(void* dest, int value, size_t size) {
+    count_access((uintptr_t) dest, size, true);
+    return __real_memset(dest, value, size);
+}
+
+// Hardware access, replaced by the simulated hardware
+void __wrap_outb(uint16_t port, uint8_t value) {
+    (void) port;
+    (void) value;
+}
+
+uint8_t __wrap_inb(uint16_t port) {
+    (void) port;
+    return 0;
+}
+
+void __wrap_halt(bool forever) {
+    if (forever) {
+        // The payload only does this when something went wrong, after drawing an error color
+        end_tick();
+        fprintf(stderr, "The payload halted forever at %" PRIu64 " ms\n", simulated_ns / NS_PER_MS);
+        dump_frame(frame);
+        print_statistics();
+        exit(EXIT_FAILURE);
+    }
+
+    // Nothing else to do until the next tick, so fast-forward to it
+    if (!timeline_running) {
+        run_timeline();
+    }
+}
+
+void setup_interrupts(void (*tickFunction) (void)) {
+    set_irq_handler(0, tickFunction);
+}
+
+void set_irq_handler(uint8_t irq, void (*handler)(void)) {
+    if (irq >= IRQ_LINES) {
+        return;
+    }
+
+    if (irq == 0 && handler != irq_handlers[0] && handler != NULL && phase < MAX_PHASES - 1) {
+        ++phase;
+    }
+
+    irq_handlers[irq] = handler;
+}
+
+uint32_t get_tick_count(void) {
+    return ticks;
+}
+
+void sti(void) {
+}
+
+void cli(void) {
+}
+
+void setup_clock(void) {
+}
+
+uint64_t now_ns(void) {
+    return simulated_ns;
+}
+
+void run_timeline(void) {
+    struct timespec wall_start;
+    struct timespec wall_end;
+
+    timeline_running = true;
+    clock_gettime(CLOCK_MONOTONIC, &wall_start);
+
+    // Account what start() did before the first tick
+    end_tick();
+
+    while (simulated_ns < duration_ns) {
+        ++ticks;
+        simulated_ns = (uint64_t) ticks * PIT_RELOAD * 1000000000ULL / PIT_FREQUENCY;
+
+        tick_phase = phase;
+        if (irq_handlers[0] != NULL) {
+            irq_handlers[0]();
+        }
+
+        end_tick();
+    }
+
+    clock_gettime(CLOCK_MONOTONIC, &wall_end);
+
+    print_statistics();
+    printf(
+        "Simulated %" PRIu64 " ms in %ld ms\n", simulated_ns / NS_PER_MS,
+        (long) ((wall_end.tv_sec - wall_start.tv_sec) * 1000 + (wall_end.tv_nsec - wall_start.tv_nsec) / 1000000)
+    );
+
+    exit(EXIT_SUCCESS);
+}
+
+void end_tick(void) {
+    struct PhaseStats* stats = &phase_stats[tick_phase];
+    bool dump = dump_interval > 0 && frame % dump_interval == 0;
+
+    stats->traffic.framebuffer_read += tick_traffic.framebuffer_read;
+    stats->traffic.framebuffer_written += tick_traffic.framebuffer_written;
+    stats->traffic.other_read += tick_traffic.other_read;
+    stats->traffic.other_written += tick_traffic.other_written;
+
+    if (tick_traffic.framebuffer_read > 0 || tick_traffic.framebuffer_written > 0) {
+        if (verbose) {
+            printf(
+                "Frame %u: %" PRIu64 " ms, phase %u, framebuffer %" PRIu64 " B read, %" PRIu64 " B written, "
+                "other memory %" PRIu64 " B read, %" PRIu64 " B written\n",
+                frame, simulated_ns / NS_PER_MS, tick_phase,
+                tick_traffic.framebuffer_read, tick_traffic.framebuffer_written,
+                tick_traffic.other_read, tick_traffic.other_written
+            );
+        }
+
+        for (unsigned int i = 0; i < dumped_frame_count; ++i) {
+            dump = dump || dumped_frames[i] == frame;
+        }
+
+        if (dump && !dump_frame(frame)) {
+            exit(EXIT_FAILURE);
+        }
+
+        ++stats->frames;
+        ++frame;
+    }
+
+    tick_traffic = (struct Traffic) { 0 };
+}
+
+bool dump_frame(unsigned int number) {
+    char path[4096];
+    uint8_t* row = malloc(modeInfoBlockPtr->XResolution * 3);
+
+    snprintf(path, sizeof(path), "%s/frame_%05u.ppm", dump_directory, number);
+
+    FILE* file = fopen(path, "wb");
+    if (file == NULL || row == NULL) {
+        perror(path);
+        free(row);
+        return false;
+    }
+
+    fprintf(file, "P6\n%u %u\n255\n", modeInfoBlockPtr->XResolution, modeInfoBlockPtr->YResolution);
+
+    for (uint16_t j = 0; j < modeInfoBlockPtr->YResolution; ++j) {
+        uint8_t* scanline = framebuffer + j * modeInfoBlockPtr->BytesPerScanLine;
+
+        // The framebuffer stores pixels in BGR order, and PPM in RGB order
+        for (uint16_t i = 0; i < modeInfoBlockPtr->XResolution; ++i) {
+            row[i * 3] = scanline[i * 3 + 2];
+            row[i * 3 + 1] = scanline[i * 3 + 1];
+            row[i * 3 + 2] = scanline[i * 3];
+        }
+
+        fwrite(row, 3, modeInfoBlockPtr->XResolution, file);
+    }
+
+    free(row);
+
+    if (fclose(file) != 0) {
+        perror(path);
+        return false;
+    }
+
+    return true;
+}
+
+void print_statistics(void) {
+    printf("Phase  Frames  Framebuffer read  Framebuffer written  Other read  Other written  (bytes per frame)\n");
+
+    for (unsigned int i = 0; i <= phase; ++i) {
+        struct PhaseStats* stats = &phase_stats[i];
+        unsigned int frames = stats->frames > 0 ? stats->frames : 1;
+
+        printf(
+            "%5u  %6u  %16" PRIu64 "  %19" PRIu64 "  %10" PRIu64 "  %13" PRIu64 "\n",
+            i, stats->frames,
+            stats->traffic.framebuffer_read / frames, stats->traffic.framebuffer_written / frames,
+            stats->traffic.other_read / frames, stats->traffic.other_written / frames
+        );
+    }
+}
+
+void print_usage(const char* program) {
+    fprintf(
+        stderr,
+        "Syntax: %s [-x width] [-y height] [-t seconds] [-s seed] [-d frame,...] [-e interval] [-o directory] [-v]\n"
+        "  -x, -y  Video mode resolution. Default: 640x480, 24 bits per pixel\n"
+        "  -t      Simulated time to run the payload for. Default: 10 s\n"
+        "  -s      BIOS timer tick count, which seeds the payload random numbers. Default: 0\n"
+        "  -d      Frames to dump as PPM images\n"
+        "  -e      Dump every frame that is a multiple of this interval too\n"
+        "  -o      Directory for the dumped frames. Default: current directory\n"
+        "  -v      Print the memory traffic of every frame\n",
+        program
+    );
+}
+
+bool parse_frame_list(char* list) {
+    for (char* number = strtok(list, ","); number != NULL; number = strtok(NULL, ",")) {
+        if (dumped_frame_count == MAX_DUMPED_FRAMES) {
+            fprintf(stderr, "At most %u frames can be dumped\n", MAX_DUMPED_FRAMES);
+            return false;
+        }
+
+        dumped_frames[dumped_frame_count++] = strtoul(number, NULL, 10);
+    }
+
+    return true;
+}
+
+bool setup_memory(uint16_t width, uint16_t height) {
+    void* conventional_memory = mmap(
+        (void*) CONVENTIONAL_MEMORY_START, CONVENTIONAL_MEMORY_END - CONVENTIONAL_MEMORY_START,
+        PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED_NOREPLACE, -1, 0
+    );
+    void* extended_memory = mmap(
+        NULL, EXTENDED_MEMORY_SIZE, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0
+    );
+    // Where the payload looks for the A20 line wrapping around, which it never does here
+    void* a20_test_page = mmap(
+        (void*) A20_TEST_PAGE, 4096, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED_NOREPLACE, -1, 0
+    );
+
+    if (conventional_memory != (void*) CONVENTIONAL_MEMORY_START || extended_memory == MAP_FAILED ||
+        a20_test_page != (void*) A20_TEST_PAGE) {
+        fprintf(stderr, "Couldn't map the simulated memory\n");
+        return false;
+    }
+
+    framebuffer_size = (size_t) width * height * 3;
+    framebuffer = calloc(framebuffer_size, 1);
+    if (framebuffer == NULL) {
+        fprintf(stderr, "Couldn't allocate the framebuffer\n");
+        return false;
+    }
+
+    // What the BIOS and the bootloader would hand over. Memory is zeroed by mmap
+    *(uint32_t*) (BIOS_DATA_AREA_ADDRESS + BIOS_TICK_COUNT_OFFSET) = seed;
+
+    struct ModeInfoBlock* mode_info_block = (struct ModeInfoBlock*) modeInfoBlockPtr;
+    mode_info_block->XResolution = width;
+    mode_info_block->YResolution = height;
+    mode_info_block->BytesPerScanLine = width * 3;
+    mode_info_block->BitsPerPixel = 24;
+    mode_info_block->PhysBasePtr = framebuffer;
+
+    struct MemoryMap* memory_map = (struct MemoryMap*) memoryMapPtr;
+    memory_map->EntryCount = 1;
+    memory_map->Entries[0].BaseAddress = (uintptr_t) extended_memory;
+    memory_map->Entries[0].Length = EXTENDED_MEMORY_SIZE;
+    memory_map->Entries[0].Type = MEMORY_MAP_USABLE;
+    memory_map->Entries[0].ExtendedAttributes = MEMORY_MAP_ENTRY_VALID;
+
+    return true;
+}
+
+int main(int argc, char** argv) {
+    unsigned long width = 640;
+    unsigned long height = 480;
+    int option;
+
+    while ((option = getopt(argc, argv, "x:y:t:s:d:e:o:v")) != -1) {
+        switch (option) {
+            case 'x':
+                width = strtoul(optarg, NULL, 10);
+                break;
+            case 'y':
+                height = strtoul(optarg, NULL, 10);
+                break;
+            case 't':
+                duration_ns = strtoull(optarg, NULL, 10) * 1000000000ULL;
+                break;
+            case 's':
+                seed = strtoul(optarg, NULL, 10);
+                break;
+            case 'd':
+                if (!parse_frame_list(optarg)) {
+                    return EXIT_FAILURE;
+                }
+                break;
+            case 'e':
+                dump_interval = strtoul(optarg, NULL, 10);
+                break;
+            case 'o':
+                dump_directory = optarg;
+                break;
+            case 'v':
+                verbose = true;
+                break;
+            default:
+                print_usage(argv[0]);
+                return EXIT_FAILURE;
+        }
+    }
+
+    // Same limits the bootloader applies when selecting a video mode
+    if (optind != argc || width < 640 || width > 2550 || height < 480 || height > 2550) {
+        print_usage(argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    if (!setup_memory(width, height)) {
+        return EXIT_FAILURE;
+    }
+
+    // Never returns: the first time the payload waits for a tick, the timeline runs
+    start();
+
+    return EXIT_FAILURE;
+}
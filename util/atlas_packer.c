@@ -0,0 +1,226 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include <stdbool.h>
+
+// Must match load_atlas in atlas.c
+#define MAX_IMAGES 255
+#define MAX_SIZE 65535
+
+struct AtlasImage {
+    unsigned int width;
+    unsigned int height;
+    size_t row_bytes;
+    unsigned char* raster;
+    // Position in the atlas. x is always a multiple of 8, so every image row
+    // starts at a byte boundary
+    unsigned int x;
+    unsigned int y;
+};
+
+/*
+ * Reads an unsigned integer from a PBM header, skipping any whitespace before it.
+ * Returns 0 on error.
+ */
+static unsigned int read_header_integer(FILE* file) {
+    unsigned int n = 0;
+    int c;
+
+    while ((c = getc(file)) != EOF && isspace(c));
+
+    while (c != EOF && isdigit(c)) {
+        n = 10 * n + (c - '0');
+        c = getc(file);
+    }
+
+    if (c != EOF) {
+        ungetc(c, file);
+    }
+
+    return n;
+}
+
+/*
+ * Reads a raw PBM image without comments. Returns 0 on success.
+ */
+static int read_image(const char* path, struct AtlasImage* image) {
+    FILE* file = fopen(path, "rb");
+    int result = 1;
+
+    if (file == NULL) {
+        perror(path);
+        return 1;
+    }
+
+    if (getc(file) != 'P' || getc(file) != '4') {
+        fprintf(stderr, "%s is not a raw PBM image without comments\n", path);
+    } else {
+        image->width = read_header_integer(file);
+        image->height = read_header_integer(file);
+        image->row_bytes = image->width / 8 + (image->width % 8 == 0 ? 0 : 1);
+
+        if (image->width == 0 || image->height == 0 || image->width > MAX_SIZE ||
+            image->height > MAX_SIZE || !isspace(getc(file))) {
+            fprintf(stderr, "%s has an invalid PBM image header\n", path);
+        } else if ((image->raster = malloc(image->row_bytes * image->height)) == NULL) {
+            perror("Could not allocate the raster buffer");
+        } else if (fread(image->raster, 1, image->row_bytes * image->height, file) != image->row_bytes * image->height) {
+            fprintf(stderr, "Unexpected end of PBM raster data in %s\n", path);
+        } else {
+            result = 0;
+        }
+    }
+
+    fclose(file);
+
+    return result;
+}
+
+/*
+ * Places the images in shelves as wide as the atlas, in the specified order, so
+ * every shelf is as tall as its first image. Returns the height of the atlas.
+ */
+static unsigned int pack_shelves(struct AtlasImage* images, const size_t* order, size_t image_count, unsigned int atlas_width) {
+    unsigned int atlas_height = 0;
+    unsigned int shelf_x = 0;
+    unsigned int shelf_height = 0;
+
+    for (size_t i = 0; i < image_count; ++i) {
+        struct AtlasImage* image = &images[order[i]];
+
+        if (shelf_x + image->row_bytes * 8 > atlas_width) {
+            atlas_height += shelf_height;
+            shelf_x = 0;
+            shelf_height = 0;
+        }
+
+        image->x = shelf_x;
+        image->y = atlas_height;
+        shelf_x += image->row_bytes * 8;
+
+        if (image->height > shelf_height) {
+            shelf_height = image->height;
+        }
+    }
+
+    return atlas_height + shelf_height;
+}
+
+/*
+ * Writes a 16-bit integer, least significant byte first.
+ */
+static void put_u16(unsigned int n) {
+    putchar(n & 0xFF);
+    putchar(n >> 8);
+}
+
+int main(int argc, char** argv) {
+    struct AtlasImage images[MAX_IMAGES];
+    size_t order[MAX_IMAGES];
+    bool table = argc > 1 && strcmp(argv[1], "-t") == 0;
+    size_t image_count = argc - 1 - table;
+    char** paths = argv + 1 + table;
+    unsigned int atlas_width = 0;
+    unsigned int atlas_height = 0;
+    unsigned int widest_image = 0;
+    unsigned int all_images_width = 0;
+    size_t atlas_row_bytes;
+    unsigned char* atlas;
+    int error_occured;
+
+    if (image_count == 0 || image_count > MAX_IMAGES) {
+        fprintf(stderr, "Syntax: %s [-t] image.pbm... > atlas\n", argv[0]);
+        fprintf(stderr, "  Packs up to %d PBM images in a single PBM image. With -t, the position and size\n", MAX_IMAGES);
+        fprintf(stderr, "  of every image in it are written instead, in the order the images were given.\n");
+        return EXIT_FAILURE;
+    }
+
+    for (size_t i = 0; i < image_count; ++i) {
+        if (read_image(paths[i], &images[i]) != 0) {
+            return EXIT_FAILURE;
+        }
+
+        if (images[i].row_bytes * 8 > widest_image) {
+            widest_image = images[i].row_bytes * 8;
+        }
+
+        all_images_width += images[i].row_bytes * 8;
+    }
+
+    // Pack the images in shelves, tallest first, so the shorter ones fill the
+    // shelves of the taller ones. Ties keep the given order, so the layout only
+    // depends on the images
+    for (size_t i = 0; i < image_count; ++i) {
+        size_t j = i;
+
+        while (j > 0 && images[order[j - 1]].height < images[i].height) {
+            order[j] = order[j - 1];
+            --j;
+        }
+
+        order[j] = i;
+    }
+
+    // The atlas is as narrow as possible while taking the least area, so the blank
+    // space left beside the shorter images is the smallest. Every width from the
+    // widest image to all the images side by side is tried
+    for (unsigned int width = widest_image; width <= all_images_width; width += 8) {
+        unsigned int height = pack_shelves(images, order, image_count, width);
+
+        if (atlas_width == 0 || (unsigned long) width * height < (unsigned long) atlas_width * atlas_height) {
+            atlas_width = width;
+            atlas_height = height;
+        }
+    }
+
+    pack_shelves(images, order, image_count, atlas_width);
+    if (atlas_height > MAX_SIZE) {
+        fprintf(stderr, "The atlas can be %d pixels tall at most\n", MAX_SIZE);
+        return EXIT_FAILURE;
+    }
+
+    if (table) {
+        // Image count, then the x, y, width and height of every image
+        putchar(image_count);
+
+        for (size_t i = 0; i < image_count; ++i) {
+            put_u16(images[i].x);
+            put_u16(images[i].y);
+            put_u16(images[i].width);
+            put_u16(images[i].height);
+        }
+    } else {
+        atlas_row_bytes = atlas_width / 8;
+        atlas = calloc(atlas_row_bytes * atlas_height, 1);
+        if (atlas == NULL) {
+            perror("Could not allocate the atlas buffer");
+            return EXIT_FAILURE;
+        }
+
+        for (size_t i = 0; i < image_count; ++i) {
+            for (unsigned int y = 0; y < images[i].height; ++y) {
+                memcpy(
+                    atlas + (images[i].y + y) * atlas_row_bytes + images[i].x / 8,
+                    images[i].raster + y * images[i].row_bytes, images[i].row_bytes
+                );
+            }
+        }
+
+        printf("P4\n%u %u\n", atlas_width, atlas_height);
+        fwrite(atlas, 1, atlas_row_bytes * atlas_height, stdout);
+        free(atlas);
+    }
+
+    for (size_t i = 0; i < image_count; ++i) {
+        free(images[i].raster);
+    }
+
+    error_occured = ferror(stdout);
+
+    if (error_occured) {
+        perror("An I/O error occured");
+    }
+
+    return error_occured;
+}
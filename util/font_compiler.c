@@ -0,0 +1,235 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include <stdbool.h>
+
+// Must match FONT_MAX_GLYPHS in drawing.h
+#define MAX_GLYPHS 32
+#define MAX_GLYPH_WIDTH 255
+#define MAX_GLYPH_ADVANCE 255
+#define MAX_HEIGHT 255
+
+/*
+ * Reads an unsigned integer from a PBM header, skipping any whitespace before it.
+ * Returns 0 on error.
+ */
+static unsigned int read_header_integer(void) {
+    unsigned int n = 0;
+    int c;
+
+    while ((c = getchar()) != EOF && isspace(c));
+
+    while (c != EOF && isdigit(c)) {
+        n = 10 * n + (c - '0');
+        c = getchar();
+    }
+
+    if (c != EOF) {
+        ungetc(c, stdin);
+    }
+
+    return n;
+}
+
+/*
+ * Decodes a UTF-8 string into Latin-1 characters, which is what the payload
+ * strings use. Returns the number of characters, or 0 if some character is
+ * not representable in Latin-1.
+ */
+static size_t decode_characters(const char* s, unsigned char* characters) {
+    const unsigned char* p = (const unsigned char*) s;
+    size_t count = 0;
+
+    while (*p != '\0' && count < MAX_GLYPHS) {
+        if (*p < 0x80) {
+            characters[count++] = *p++;
+        } else if ((*p & 0xFE) == 0xC2 && (p[1] & 0xC0) == 0x80) {
+            characters[count++] = (*p & 0x03) << 6 | (p[1] & 0x3F);
+            p += 2;
+        } else {
+            return 0;
+        }
+    }
+
+    return *p == '\0' ? count : 0;
+}
+
+/*
+ * Returns whether the pixel at (x, y) of a PBM raster is ink.
+ */
+static bool ink(const unsigned char* raster, size_t row_bytes, unsigned int x, unsigned int y, bool invert) {
+    bool black = ((raster[y * row_bytes + x / 8] << (x % 8)) & 0x80) != 0;
+    return black != invert;
+}
+
+/*
+ * Returns whether the ink of a row of a glyph is the same as in the previous row.
+ */
+static bool same_row(const unsigned char* raster, size_t row_bytes, unsigned int start, unsigned int width, unsigned int y, bool invert) {
+    for (unsigned int x = start; x < start + width; ++x) {
+        if (ink(raster, row_bytes, x, y, invert) != ink(raster, row_bytes, x, y - 1, invert)) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+int main(int argc, char** argv) {
+    unsigned char characters[MAX_GLYPHS];
+    unsigned int glyph_start[MAX_GLYPHS];
+    unsigned int glyph_width[MAX_GLYPHS];
+    unsigned int glyph_advance[MAX_GLYPHS];
+    size_t character_count;
+    size_t glyph_count = 0;
+    unsigned int width;
+    unsigned int height;
+    unsigned int spacing = 0;
+    size_t row_bytes;
+    unsigned char* raster;
+    bool invert = argc == 3 && strcmp(argv[1], "-i") == 0;
+    int error_occured;
+
+    if (argc != 2 + invert) {
+        fprintf(stderr, "Syntax: %s [-i] CHARACTERS < sheet.pbm > font\n", argv[0]);
+        fprintf(stderr, "  Glyphs are separated by blank columns, and appear in the sheet in the same order\n");
+        fprintf(stderr, "  as CHARACTERS. With -i, white pixels are ink, instead of black ones.\n");
+        return EXIT_FAILURE;
+    }
+
+    character_count = decode_characters(argv[1 + invert], characters);
+    if (character_count == 0) {
+        fprintf(stderr, "The characters must be Latin-1 ones, and there must be %d at most\n", MAX_GLYPHS);
+        return EXIT_FAILURE;
+    }
+
+    // Comments are not supported, just like in the payload decoder
+    if (getchar() != 'P' || getchar() != '4') {
+        fprintf(stderr, "The input is not a raw PBM image without comments\n");
+        return EXIT_FAILURE;
+    }
+
+    width = read_header_integer();
+    height = read_header_integer();
+    if (width == 0 || height == 0 || height > MAX_HEIGHT || !isspace(getchar())) {
+        fprintf(stderr, "Invalid PBM image header, or the image is taller than %d pixels\n", MAX_HEIGHT);
+        return EXIT_FAILURE;
+    }
+
+    row_bytes = width / 8 + (width % 8 == 0 ? 0 : 1);
+    raster = malloc(row_bytes * height);
+    if (raster == NULL) {
+        perror("Could not allocate the raster buffer");
+        return EXIT_FAILURE;
+    }
+
+    if (fread(raster, 1, row_bytes * height, stdin) != row_bytes * height) {
+        fprintf(stderr, "Unexpected end of PBM raster data\n");
+        free(raster);
+        return EXIT_FAILURE;
+    }
+
+    // Every run of columns with some ink in them is a glyph
+    for (unsigned int x = 0; x < width; ++x) {
+        bool column_ink = false;
+
+        for (unsigned int y = 0; y < height && !column_ink; ++y) {
+            column_ink = ink(raster, row_bytes, x, y, invert);
+        }
+
+        if (column_ink && (glyph_count == 0 || glyph_start[glyph_count - 1] + glyph_width[glyph_count - 1] != x)) {
+            if (glyph_count == character_count) {
+                glyph_count = character_count + 1;
+                break;
+            }
+
+            // Every glyph is followed by as many columns as in the sheet, so text is
+            // drawn like it is there. The last one takes the smallest gap between glyphs
+            if (glyph_count > 0) {
+                unsigned int gap = x - glyph_start[glyph_count - 1] - glyph_width[glyph_count - 1];
+                glyph_advance[glyph_count - 1] = x - glyph_start[glyph_count - 1];
+                spacing = glyph_count == 1 || gap < spacing ? gap : spacing;
+            }
+
+            glyph_start[glyph_count] = x;
+            glyph_width[glyph_count++] = 0;
+        }
+
+        if (column_ink) {
+            ++glyph_width[glyph_count - 1];
+        }
+    }
+
+    if (glyph_count != character_count) {
+        fprintf(stderr, "The sheet has %s glyphs than characters were given\n", glyph_count < character_count ? "less" : "more");
+        free(raster);
+        return EXIT_FAILURE;
+    }
+
+    glyph_advance[glyph_count - 1] = glyph_width[glyph_count - 1] + spacing;
+
+    // Header: height, glyph count, and the character, width and advance of every glyph
+    putchar(height);
+    putchar(glyph_count);
+    for (size_t i = 0; i < glyph_count; ++i) {
+        if (glyph_width[i] > MAX_GLYPH_WIDTH || glyph_advance[i] > MAX_GLYPH_ADVANCE) {
+            fprintf(stderr, "Glyphs can be %d pixels wide at most, and %d apart\n", MAX_GLYPH_WIDTH, MAX_GLYPH_ADVANCE);
+            free(raster);
+            return EXIT_FAILURE;
+        }
+
+        putchar(characters[i]);
+        putchar(glyph_width[i]);
+        putchar(glyph_advance[i]);
+    }
+
+    // Then every glyph. Glyph strokes are mostly vertical, so there is a bit per row
+    // first, set if the row is the same as the previous one, most significant bit
+    // first. Then the bitmap of the rest of rows, one bit per pixel, without padding
+    // between rows. Each glyph starts on a new byte
+    for (size_t i = 0; i < glyph_count; ++i) {
+        unsigned char current_byte = 0;
+        unsigned int bits = 0;
+
+        for (unsigned int y = 0; y < height; ++y) {
+            current_byte = current_byte << 1 | (y > 0 && same_row(raster, row_bytes, glyph_start[i], glyph_width[i], y, invert));
+
+            if (++bits == 8 || y == height - 1) {
+                putchar(current_byte << (8 - bits));
+                current_byte = 0;
+                bits = 0;
+            }
+        }
+
+        for (unsigned int y = 0; y < height; ++y) {
+            if (y > 0 && same_row(raster, row_bytes, glyph_start[i], glyph_width[i], y, invert)) {
+                continue;
+            }
+
+            for (unsigned int x = glyph_start[i]; x < glyph_start[i] + glyph_width[i]; ++x) {
+                current_byte = current_byte << 1 | ink(raster, row_bytes, x, y, invert);
+
+                if (++bits == 8) {
+                    putchar(current_byte);
+                    current_byte = 0;
+                    bits = 0;
+                }
+            }
+        }
+
+        if (bits > 0) {
+            putchar(current_byte << (8 - bits));
+        }
+    }
+
+    free(raster);
+
+    error_occured = ferror(stdin) || ferror(stdout);
+
+    if (error_occured) {
+        perror("An I/O error occured");
+    }
+
+    return error_occured;
+}
@@ -0,0 +1,134 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+
+// Must match the decoder in payload_stub.asm
+#define WINDOW_SIZE 4096
+#define MIN_MATCH_LENGTH 3
+#define MAX_MATCH_LENGTH (15 + MIN_MATCH_LENGTH)
+
+/*
+ * Writes a 32-bit unsigned integer in little endian byte order.
+ */
+static void put_uint32(uint32_t value) {
+    for (int i = 0; i < 4; ++i) {
+        putchar((value >> (8 * i)) & 0xFF);
+    }
+}
+
+int main(int argc, char** argv) {
+    unsigned char* input = NULL;
+    unsigned char* output;
+    size_t input_size = 0;
+    size_t input_capacity = 0;
+    size_t output_size = 0;
+    size_t flags_pos = 0;
+    unsigned int items_in_group = 8;
+    int current_byte;
+    int error_occured;
+
+    if (argc != 1) {
+        fprintf(stderr, "Syntax: %s\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    // The header needs the size of the compressed stream, so read all the input first
+    while ((current_byte = getchar()) != EOF) {
+        if (input_size == input_capacity) {
+            input_capacity = input_capacity == 0 ? 4096 : input_capacity * 2;
+            input = realloc(input, input_capacity);
+            if (input == NULL) {
+                perror("Could not allocate the input buffer");
+                return EXIT_FAILURE;
+            }
+        }
+
+        input[input_size++] = current_byte;
+    }
+
+    // Worst case: every byte is a literal, plus a flag byte every 8 items
+    output = malloc(input_size + input_size / 8 + 1);
+    if (output == NULL) {
+        perror("Could not allocate the output buffer");
+        free(input);
+        return EXIT_FAILURE;
+    }
+
+    // Bits it takes to encode the input from each position on, and the item that
+    // does it, computed backwards. Literals take 9 bits with their flag, and matches
+    // 17, so taking the longest match at every position is not always the best choice
+    size_t* cost = malloc((input_size + 1) * sizeof(size_t));
+    size_t* item_length = malloc(input_size * sizeof(size_t));
+    size_t* item_distance = malloc(input_size * sizeof(size_t));
+    if (cost == NULL || item_length == NULL || item_distance == NULL) {
+        perror("Could not allocate the parsing buffers");
+        free(input);
+        free(output);
+        free(cost);
+        free(item_length);
+        free(item_distance);
+        return EXIT_FAILURE;
+    }
+
+    cost[input_size] = 0;
+
+    for (size_t i = input_size; i-- > 0;) {
+        cost[i] = 9 + cost[i + 1];
+        item_length[i] = 1;
+
+        // Matches may overlap the current position, as the decoder copies byte by byte
+        for (size_t distance = 1; distance <= WINDOW_SIZE && distance <= i; ++distance) {
+            size_t length = 0;
+
+            while (length < MAX_MATCH_LENGTH && i + length < input_size &&
+                input[i + length - distance] == input[i + length]
+            ) {
+                ++length;
+
+                if (length >= MIN_MATCH_LENGTH && 17 + cost[i + length] < cost[i]) {
+                    cost[i] = 17 + cost[i + length];
+                    item_length[i] = length;
+                    item_distance[i] = distance;
+                }
+            }
+        }
+    }
+
+    for (size_t i = 0; i < input_size; i += item_length[i]) {
+        if (items_in_group == 8) {
+            flags_pos = output_size;
+            output[output_size++] = 0;
+            items_in_group = 0;
+        }
+
+        if (item_length[i] >= MIN_MATCH_LENGTH) {
+            unsigned int token = ((item_distance[i] - 1) << 4) | (item_length[i] - MIN_MATCH_LENGTH);
+
+            output[output_size++] = token & 0xFF;
+            output[output_size++] = token >> 8;
+        } else {
+            output[flags_pos] |= 1 << items_in_group;
+            output[output_size++] = input[i];
+        }
+
+        ++items_in_group;
+    }
+
+    put_uint32(input_size);
+    put_uint32(output_size);
+    fwrite(output, 1, output_size, stdout);
+
+    free(input);
+    free(output);
+    free(cost);
+    free(item_length);
+    free(item_distance);
+
+    error_occured = ferror(stdin) || ferror(stdout);
+
+    if (error_occured) {
+        perror("An I/O error occured");
+    }
+
+    return error_occured;
+}
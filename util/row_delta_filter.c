@@ -0,0 +1,92 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <ctype.h>
+
+/*
+ * Reads an unsigned integer from a PBM header, skipping any whitespace before it,
+ * and echoes everything read to the standard output. Returns 0 on error.
+ */
+static unsigned int copy_header_integer(void) {
+    unsigned int n = 0;
+    int c;
+
+    while ((c = getchar()) != EOF && isspace(c)) {
+        putchar(c);
+    }
+
+    while (c != EOF && isdigit(c)) {
+        n = 10 * n + (c - '0');
+        putchar(c);
+        c = getchar();
+    }
+
+    // Put back the delimiter, so it is copied as well
+    if (c != EOF) {
+        ungetc(c, stdin);
+    }
+
+    return n;
+}
+
+int main(int argc, char** argv) {
+    unsigned int width;
+    unsigned int height;
+    size_t row_bytes;
+    unsigned char* previous_row;
+    int delimiter;
+    int error_occured;
+
+    if (argc != 1) {
+        fprintf(stderr, "Syntax: %s\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    // Copy the header as-is. Comments are not supported, just like in the payload decoder
+    if (getchar() != 'P' || getchar() != '4') {
+        fprintf(stderr, "The input is not a raw PBM image without comments\n");
+        return EXIT_FAILURE;
+    }
+    fputs("P4", stdout);
+
+    width = copy_header_integer();
+    height = copy_header_integer();
+    delimiter = getchar();
+    if (width == 0 || height == 0 || delimiter == EOF || !isspace(delimiter)) {
+        fprintf(stderr, "Invalid PBM image header\n");
+        return EXIT_FAILURE;
+    }
+    putchar(delimiter);
+
+    // Replace every raster row with the XOR of it and the previous row, so
+    // vertically coherent images become mostly zero bytes. The first row
+    // is XORed with an all zeros row, so it is unchanged
+    row_bytes = width / 8 + (width % 8 == 0 ? 0 : 1);
+    previous_row = calloc(row_bytes, 1);
+    if (previous_row == NULL) {
+        perror("Could not allocate the row buffer");
+        return EXIT_FAILURE;
+    }
+
+    for (size_t i = 0; i < row_bytes * height; ++i) {
+        int current_byte = getchar();
+
+        if (current_byte == EOF) {
+            fprintf(stderr, "Unexpected end of PBM raster data\n");
+            free(previous_row);
+            return EXIT_FAILURE;
+        }
+
+        putchar(current_byte ^ previous_row[i % row_bytes]);
+        previous_row[i % row_bytes] = current_byte;
+    }
+
+    free(previous_row);
+
+    error_occured = ferror(stdin) || ferror(stdout);
+
+    if (error_occured) {
+        perror("An I/O error occured");
+    }
+
+    return error_occured;
+}
@@ -51,5 +51,11 @@ _Static_assert(sizeof(struct ModeInfoBlock) == 256, "ModeInfoBlock size must equ
 _Static_assert(sizeof(uint32_t) == sizeof(uint8_t*), "A uint8_t pointer must be 4 bytes long");
 _Static_assert(sizeof(uint32_t) == sizeof(void*), "A void pointer must be 4 bytes long");
 
+// Where the bootloader stores the ModeInfoBlock. Hosted builds, like the simulator,
+// may define it elsewhere, because the first page of memory can't be mapped there
+#ifndef MODE_INFO_BLOCK_ADDRESS
+#define MODE_INFO_BLOCK_ADDRESS 0x0700
+#endif
+
 // A pointer to the VBE 2.0 ModeInfoBlock structure made available by the bootloader.
-static const struct ModeInfoBlock* modeInfoBlockPtr = (struct ModeInfoBlock*) 0x0700;
+static const struct ModeInfoBlock* modeInfoBlockPtr = (struct ModeInfoBlock*) MODE_INFO_BLOCK_ADDRESS;